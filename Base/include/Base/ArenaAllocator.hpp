@@ -0,0 +1,275 @@
+/**
+ * @file ArenaAllocator.hpp
+ * @brief Bump-pointer allocator which frees everything at once
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Hands out memory by bumping a pointer through a chain of chunks
+ *
+ * Only the most recent block can be reallocated inplace or deallocated, every other
+ * block lives until `ArenaAllocator::reset()`
+ *
+ * @tparam P Type of allocator which provides chunks, `mem::NullAllocator` restricts the
+ * arena to the buffer it was constructed with
+ * @tparam C Minimum size of a chunk requested from the parent allocator
+ */
+template <typename P = mem::SystemAllocator, u64 C = 64 * 1024>
+struct ArenaAllocator
+{
+protected:
+    constant u64 ALIGNMENT = 16;
+
+    struct Chunk
+    {
+        Chunk * previous;
+        u64 size;
+        bool owned;
+    };
+
+    constant u64 HEADER_SIZE = mem::align_up(sizeof(Chunk), ALIGNMENT);
+
+    P * parent_ = null;
+    Chunk * current_ = null;
+    byte * cursor_ = null;
+    byte * end_ = null;
+
+    /**
+     * @brief Makes `chunk` the chunk that allocations are carved out of
+     */
+    void use_chunk(Chunk * chunk)
+    {
+        current_ = chunk;
+        cursor_ = cast(byte *, chunk) + HEADER_SIZE;
+        end_ = cast(byte *, chunk) + chunk->size;
+    }
+
+    /**
+     * @brief Places a chunk header at the start of `block` and makes it current
+     */
+    void push_chunk(mem::Block block, bool owned)
+    {
+        Chunk * chunk = cast(Chunk *, block.data);
+        chunk->previous = current_;
+        chunk->size = block.size;
+        chunk->owned = owned;
+        use_chunk(chunk);
+    }
+
+    /**
+     * @brief Returns a chunk to the parent allocator, if it came from there
+     */
+    void release_chunk(Chunk * chunk)
+    {
+        if (chunk->owned)
+        {
+            mem::Block block { chunk, chunk->size };
+            parent_->deallocate(block);
+        }
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether `block` is the most recent allocation of the current chunk
+     */
+    bool is_last(mem::Block & block) const
+    {
+        return cast(byte *, block.data) + block.size == cursor_;
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static ArenaAllocator * instance()
+    {
+        static ArenaAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (alignment < ALIGNMENT)
+        {
+            alignment = ALIGNMENT;
+        }
+
+        byte * data = cast(byte *, mem::align_up(cast(u64, cursor_), alignment));
+        if (current_ == null or data > end_ or cast(u64, end_ - data) < size)
+        {
+            // NOTE:
+            //   Chunks are only aligned to `ALIGNMENT`, so over-aligned blocks need room
+            //   to be shifted forward inside of a fresh chunk
+            u64 chunk_size = mem::align_up(HEADER_SIZE + size, ALIGNMENT) + alignment - ALIGNMENT;
+            mem::Block chunk = parent_->allocate(chunk_size < C ? C : chunk_size);
+            if (not chunk)
+            {
+                return mem::Block {};
+            }
+
+            push_chunk(chunk, true);
+            data = cast(byte *, mem::align_up(cast(u64, cursor_), alignment));
+        }
+
+        cursor_ = data + size;
+        return mem::Block { data, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @return Usable size of a block allocated with `size`, which does not depend on the
+     * alignment since padding is skipped in front of the block
+     */
+    u64 good_size(u64 size, u64 = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::align_up(size, ALIGNMENT);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which only succeeds for the
+     * most recent block or when shrinking
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (is_last(block))
+        {
+            if (cast(u64, end_ - cast(byte *, block.data)) < size)
+            {
+                return false;
+            }
+            cursor_ = cast(byte *, block.data) + size;
+        }
+        else if (size > block.size)
+        {
+            return false;
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Invalidates a block of memory, which is only reclaimed if it is the most
+     * recent block
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (is_last(block))
+        {
+            cursor_ = cast(byte *, block.data);
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        byte * data = cast(byte *, block.data);
+        for (Chunk * chunk = current_; chunk != null; chunk = chunk->previous)
+        {
+            byte * start = cast(byte *, chunk);
+            if (data >= start and data < start + chunk->size)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Invalidates every block at once, keeping only the first chunk around so
+     * the next round of allocations does not need to go to the parent allocator
+     */
+    void reset()
+    {
+        if (current_ == null)
+        {
+            return;
+        }
+
+        Chunk * chunk = current_;
+        while (chunk->previous != null)
+        {
+            Chunk * previous = chunk->previous;
+            release_chunk(chunk);
+            chunk = previous;
+        }
+        use_chunk(chunk);
+    }
+
+    implicit ArenaAllocator & operator=(ArenaAllocator const & other) = delete;
+
+    /**
+     * @brief Constructs an arena which requests chunks from `parent` on demand
+     *
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit ArenaAllocator(P * parent = P::instance()) : parent_(parent)
+    {
+    }
+
+    /**
+     * @brief Constructs an arena which uses `buffer` before requesting any chunks from
+     * `parent`, the buffer is never released
+     *
+     * @param buffer Memory to carve allocations out of, must outlive the arena
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit ArenaAllocator(mem::Block buffer, P * parent = P::instance()) :
+        parent_(parent)
+    {
+        u64 offset = mem::align_up(cast(u64, buffer.data), ALIGNMENT) - cast(u64, buffer.data);
+        if (buffer and buffer.size >= offset + HEADER_SIZE)
+        {
+            push_chunk(
+                mem::Block { cast(byte *, buffer.data) + offset, buffer.size - offset },
+                false
+            );
+        }
+    }
+
+    implicit ArenaAllocator(ArenaAllocator const & other) = delete;
+
+    /**
+     * @brief Releases every chunk back to the parent allocator
+     */
+    implicit ~ArenaAllocator()
+    {
+        reset();
+        if (current_ != null)
+        {
+            release_chunk(current_);
+        }
+    }
+};
+}
\ No newline at end of file
@@ -20,6 +20,18 @@
 #include <Base/Meta.hpp>
 #include <Base/Iterate.hpp>
 #include <Base/Memory.hpp>
+#include <Base/ArenaAllocator.hpp>
+#include <Base/ScratchAllocator.hpp>
+#include <Base/FreeListAllocator.hpp>
+#include <Base/ConcurrentSlabAllocator.hpp>
+#include <Base/ThreadCacheAllocator.hpp>
+#include <Base/StackAllocator.hpp>
+#include <Base/BitmappedBlockAllocator.hpp>
+#include <Base/BuddyAllocator.hpp>
+#include <Base/VirtualAllocator.hpp>
+#include <Base/HugePageAllocator.hpp>
+#include <Base/StatsAllocator.hpp>
+#include <Base/ObjectPool.hpp>
 #include <Base/Util.hpp>
 #include <Base/Math.hpp>
 #include <Base/Data.hpp>
@@ -27,4 +39,8 @@
 #include <Base/Range.hpp>
 #include <Base/Span.hpp>
 #include <Base/Vector.hpp>
-#include <Base/File.hpp>
\ No newline at end of file
+#include <Base/SmallVector.hpp>
+#include <Base/StaticVector.hpp>
+#include <Base/String.hpp>
+#include <Base/File.hpp>
+#include <Base/TracingAllocator.hpp>
\ No newline at end of file
@@ -0,0 +1,369 @@
+/**
+ * @file BitmappedBlockAllocator.hpp
+ * @brief Allocator which tracks a contiguous region of blocks with a bitmap
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Splits a region of `Count` blocks of `BlockSize` bytes, requested from a parent
+ * allocator up front, into allocations of consecutive blocks tracked by a bitmap
+ *
+ * `owns` is a range check on the region, so the allocator is a cheap primary for
+ * `mem::FallbackAllocator`. Blocks can be freed in any order and `reallocate` grows
+ * a block inplace as long as the blocks after it are free
+ *
+ * @tparam BlockSize Size of a single block in bytes, a multiple of `mem::DEFAULT_ALIGNMENT`
+ * @tparam Count Number of blocks in the region
+ * @tparam P Type of allocator which provides the region
+ */
+template <u64 BlockSize, u64 Count, typename P = mem::SystemAllocator>
+struct BitmappedBlockAllocator
+{
+private:
+    static_assert(BlockSize > 0 and Count > 0, "Region must not be empty");
+    static_assert(
+        BlockSize % mem::DEFAULT_ALIGNMENT == 0,
+        "Blocks must keep the default alignment, every allocator has to serve it"
+    );
+
+    // NOTE:
+    //   Every block starts at a multiple of `BlockSize` in the region, so it is aligned to
+    //   the lowest set bit of `BlockSize`
+    constant u64 REGION_SIZE = BlockSize * Count;
+    constant u64 BLOCK_ALIGNMENT = BlockSize & (~BlockSize + 1);
+
+    // NOTE:
+    //   A set bit marks a used block. The bitmap is padded to a multiple of four words
+    //   with used bits, so the scan can skip full groups of words with a single check
+    constant u64 GROUP_SIZE = 4;
+    constant u64 WORD_COUNT = mem::align_up(Count, 64 * GROUP_SIZE) / 64;
+
+    P * parent_ = null;
+    byte * region_ = null;
+    u64 first_free_word_ = 0;
+    alignas(32) u64 used_[WORD_COUNT];
+
+    /**
+     * @param size Size of a block
+     * @return Number of blocks needed to hold `size` bytes
+     */
+    static macro u64 blocks_of(u64 size)
+    {
+        return (size + BlockSize - 1) / BlockSize;
+    }
+
+    /**
+     * @param block A block of memory owned by this allocator
+     * @return Index of the first block of `block` in the region
+     */
+    macro u64 index_of(mem::Block & block) const
+    {
+        return (cast(byte *, block.data) - region_) / BlockSize;
+    }
+
+    /**
+     * @brief Sets or clears the bits of `count` blocks starting at block `start`
+     */
+    void mark(u64 start, u64 count, bool used)
+    {
+        while (count > 0)
+        {
+            u64 word = start / 64;
+            u64 bit = start % 64;
+            u64 bits = count < 64 - bit ? count : 64 - bit;
+            u64 mask = (bits == 64 ? ~cast(u64, 0) : (cast(u64, 1) << bits) - 1) << bit;
+
+            used_[word] = used ? used_[word] | mask : used_[word] & ~mask;
+            start += bits;
+            count -= bits;
+        }
+    }
+
+    /**
+     * @return Whether the `count` blocks starting at block `start` are all free
+     */
+    bool is_free(u64 start, u64 count) const
+    {
+        if (start + count > Count)
+        {
+            return false;
+        }
+
+        while (count > 0)
+        {
+            u64 word = start / 64;
+            u64 bit = start % 64;
+            u64 bits = count < 64 - bit ? count : 64 - bit;
+            u64 mask = (bits == 64 ? ~cast(u64, 0) : (cast(u64, 1) << bits) - 1) << bit;
+
+            if ((used_[word] & mask) != 0)
+            {
+                return false;
+            }
+            start += bits;
+            count -= bits;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Finds the first run of `count` free blocks
+     *
+     * @return Index of the first block of the run, or `Count` if there is none
+     */
+    u64 find(u64 count) const
+    {
+        u64 run = 0;
+        u64 start = 0;
+
+        u64 word = first_free_word_;
+        while (word < WORD_COUNT)
+        {
+            // NOTE:
+            //   The and of an aligned group of words compiles down to a vector and when
+            //   targeting AVX2, and lets the scan skip 256 used blocks at once
+            if (word % GROUP_SIZE == 0)
+            {
+                u64 group = used_[word] & used_[word + 1] & used_[word + 2] & used_[word + 3];
+                if (group == ~cast(u64, 0))
+                {
+                    run = 0;
+                    word += GROUP_SIZE;
+                    continue;
+                }
+            }
+
+            u64 used = used_[word];
+            if (used == 0)
+            {
+                if (run == 0)
+                {
+                    start = word * 64;
+                }
+
+                run += 64;
+                if (run >= count)
+                {
+                    return start;
+                }
+            }
+            else if (used == ~cast(u64, 0))
+            {
+                run = 0;
+            }
+            else
+            {
+                u64 bit = 0;
+                while (bit < 64)
+                {
+                    u64 shifted = used >> bit;
+                    if ((shifted & 1) == 0)
+                    {
+                        u64 length = shifted == 0 ? 64 - bit : __builtin_ctzll(shifted);
+                        if (run == 0)
+                        {
+                            start = word * 64 + bit;
+                        }
+
+                        run += length;
+                        if (run >= count)
+                        {
+                            return start;
+                        }
+                        bit += length;
+                    }
+                    else
+                    {
+                        // NOTE:
+                        //   The bits shifted in from the top are zero, so the inverted
+                        //   word always has a set bit at or below `64 - bit`
+                        run = 0;
+                        bit += __builtin_ctzll(~shifted);
+                    }
+                }
+            }
+            word++;
+        }
+        return Count;
+    }
+
+    /**
+     * @brief Moves `first_free_word_` past the words which have no free blocks left
+     */
+    void skip_used_words()
+    {
+        while (first_free_word_ < WORD_COUNT and used_[first_free_word_] == ~cast(u64, 0))
+        {
+            first_free_word_++;
+        }
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static BitmappedBlockAllocator * instance()
+    {
+        static BitmappedBlockAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, or an empty block if there is no run of free
+     * blocks large enough or the blocks are not aligned enough
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (region_ == null or size == 0 or size > REGION_SIZE or alignment > BLOCK_ALIGNMENT)
+        {
+            return mem::Block {};
+        }
+
+        u64 count = blocks_of(size);
+        u64 start = find(count);
+        if (start == Count)
+        {
+            return mem::Block {};
+        }
+
+        mark(start, count, true);
+        skip_used_words();
+        return mem::Block { region_ + start * BlockSize, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (size > REGION_SIZE or alignment > BLOCK_ALIGNMENT)
+        {
+            return size;
+        }
+        return blocks_of(size) * BlockSize;
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which always succeeds when
+     * shrinking and succeeds when growing as long as the following blocks are free
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not owns(block) or size == 0)
+        {
+            return false;
+        }
+
+        u64 start = index_of(block);
+        u64 old_count = blocks_of(block.size);
+        u64 new_count = blocks_of(size);
+
+        if (new_count > old_count)
+        {
+            if (not is_free(start + old_count, new_count - old_count))
+            {
+                return false;
+            }
+            mark(start + old_count, new_count - old_count, true);
+            skip_used_words();
+        }
+        else if (new_count < old_count)
+        {
+            mark(start + new_count, old_count - new_count, false);
+            if ((start + new_count) / 64 < first_free_word_)
+            {
+                first_free_word_ = (start + new_count) / 64;
+            }
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (owns(block))
+        {
+            u64 start = index_of(block);
+            mark(start, blocks_of(block.size), false);
+            if (start / 64 < first_free_word_)
+            {
+                first_free_word_ = start / 64;
+            }
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        byte * data = cast(byte *, block.data);
+        return data >= region_ and data < region_ + REGION_SIZE and region_ != null;
+    }
+
+    implicit BitmappedBlockAllocator & operator=(BitmappedBlockAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor, which requests the region from the parent allocator
+     *
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit BitmappedBlockAllocator(P * parent = P::instance()) : parent_(parent)
+    {
+        for (u64 word = 0; word < WORD_COUNT; ++word)
+        {
+            used_[word] = 0;
+        }
+        mark(Count, WORD_COUNT * 64 - Count, true);
+
+        mem::Block region = parent_->allocate(REGION_SIZE, BLOCK_ALIGNMENT);
+        region_ = cast(byte *, region.data);
+    }
+
+    implicit BitmappedBlockAllocator(BitmappedBlockAllocator const & other) = delete;
+
+    /**
+     * @brief Returns the region to the parent allocator
+     */
+    implicit ~BitmappedBlockAllocator()
+    {
+        if (region_ != null)
+        {
+            mem::Block region { region_, REGION_SIZE };
+            parent_->deallocate(region);
+        }
+    }
+};
+}
\ No newline at end of file
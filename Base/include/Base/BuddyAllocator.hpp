@@ -0,0 +1,351 @@
+/**
+ * @file BuddyAllocator.hpp
+ * @brief Allocator which splits a power of two region into power of two blocks
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Hands out power of two blocks of at least `MinBlock` bytes from a `Size` byte
+ * region, splitting larger free blocks in halves and merging freed blocks with their
+ * free buddies
+ *
+ * `reallocate` shrinks blocks by splitting off their upper halves and grows them inplace
+ * by absorbing their buddies, as long as the block is the lower half at every level and
+ * every buddy on the way is free, so containers which grow geometrically rarely move
+ *
+ * @tparam Size Size of the region, a power of two
+ * @tparam MinBlock Size of the smallest block, a power of two of at least 16 bytes
+ * @tparam P Type of allocator which provides the region and its bookkeeping
+ */
+template <u64 Size, u64 MinBlock = 64, typename P = mem::SystemAllocator>
+struct BuddyAllocator
+{
+private:
+    static_assert((Size & (Size - 1)) == 0, "Region size must be a power of two");
+    static_assert((MinBlock & (MinBlock - 1)) == 0, "Block size must be a power of two");
+    static_assert(MinBlock >= 16 and MinBlock <= Size, "Block size must fit a free node");
+
+    struct Node
+    {
+        Node * previous;
+        Node * next;
+    };
+
+    // NOTE:
+    //   Every leaf (a `MinBlock` sized slot) that starts a block stores the order of the
+    //   block, with the top bit set while the block is free
+    constant u8 FREE = 0x80;
+    constant u64 LEAF_COUNT = Size / MinBlock;
+    constant u64 ORDER_COUNT = __builtin_ctzll(LEAF_COUNT) + 1;
+
+    P * parent_ = null;
+    byte * region_ = null;
+    u8 * orders_ = null;
+    Node * free_[ORDER_COUNT] = {};
+
+    /**
+     * @param order Order of a block
+     * @return Size of a block of this order
+     */
+    static macro u64 block_size(u64 order)
+    {
+        return MinBlock << order;
+    }
+
+    /**
+     * @param size Size of a block, at most `Size`
+     * @return Order of the smallest block which can hold `size` bytes
+     */
+    static macro u64 order_of(u64 size)
+    {
+        if (size <= MinBlock)
+        {
+            return 0;
+        }
+        return 64 - __builtin_clzll((size - 1) / MinBlock);
+    }
+
+    /**
+     * @return Leaf index of the block starting at `data`
+     */
+    macro u64 leaf_of(void * data) const
+    {
+        return (cast(byte *, data) - region_) / MinBlock;
+    }
+
+    /**
+     * @return The free list node of the block starting at leaf `leaf`
+     */
+    macro Node * node_of(u64 leaf) const
+    {
+        return cast(Node *, region_ + leaf * MinBlock);
+    }
+
+    /**
+     * @brief Marks the block starting at leaf `leaf` free and puts it in its free list
+     */
+    void push_free(u64 leaf, u64 order)
+    {
+        Node * node = node_of(leaf);
+        node->previous = null;
+        node->next = free_[order];
+        if (node->next != null)
+        {
+            node->next->previous = node;
+        }
+        free_[order] = node;
+        orders_[leaf] = cast(u8, order) | FREE;
+    }
+
+    /**
+     * @brief Takes the free block starting at leaf `leaf` out of its free list
+     */
+    void remove_free(u64 leaf, u64 order)
+    {
+        Node * node = node_of(leaf);
+        if (node->previous != null)
+        {
+            node->previous->next = node->next;
+        }
+        else
+        {
+            free_[order] = node->next;
+        }
+
+        if (node->next != null)
+        {
+            node->next->previous = node->previous;
+        }
+        orders_[leaf] = 0;
+    }
+
+    /**
+     * @return Whether the block starting at leaf `leaf` is free and of order `order`
+     */
+    macro bool is_free(u64 leaf, u64 order) const
+    {
+        return orders_[leaf] == (cast(u8, order) | FREE);
+    }
+
+    /**
+     * @brief Splits the block starting at leaf `leaf` from order `from` down to order
+     * `to`, freeing the upper half at every level
+     */
+    void split(u64 leaf, u64 from, u64 to)
+    {
+        while (from > to)
+        {
+            from--;
+            push_free(leaf + (cast(u64, 1) << from), from);
+        }
+        orders_[leaf] = cast(u8, to);
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static BuddyAllocator * instance()
+    {
+        static BuddyAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, or an empty block if there is no free block
+     * large enough or the blocks are not aligned enough
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (region_ == null or size == 0 or size > Size or alignment > MinBlock)
+        {
+            return mem::Block {};
+        }
+
+        u64 order = order_of(size);
+        u64 available = order;
+        while (available < ORDER_COUNT and free_[available] == null)
+        {
+            available++;
+        }
+
+        if (available == ORDER_COUNT)
+        {
+            return mem::Block {};
+        }
+
+        u64 leaf = leaf_of(free_[available]);
+        remove_free(leaf, available);
+        split(leaf, available, order);
+        return mem::Block { node_of(leaf), size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (size == 0 or size > Size or alignment > MinBlock)
+        {
+            return size;
+        }
+        return block_size(order_of(size));
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace by splitting it or by
+     * merging it with its free buddies
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not owns(block) or size == 0 or size > Size)
+        {
+            return false;
+        }
+
+        u64 leaf = leaf_of(block.data);
+        u64 old_order = order_of(block.size);
+        u64 new_order = order_of(size);
+
+        if (new_order < old_order)
+        {
+            split(leaf, old_order, new_order);
+        }
+        else if (new_order > old_order)
+        {
+            // NOTE:
+            //   The block can only grow if it is the lower half at every level up to the
+            //   new order, and if every upper half on the way is one whole free block
+            if (leaf % (cast(u64, 1) << new_order) != 0)
+            {
+                return false;
+            }
+
+            for (u64 order = old_order; order < new_order; ++order)
+            {
+                if (not is_free(leaf + (cast(u64, 1) << order), order))
+                {
+                    return false;
+                }
+            }
+
+            for (u64 order = old_order; order < new_order; ++order)
+            {
+                remove_free(leaf + (cast(u64, 1) << order), order);
+            }
+            orders_[leaf] = cast(u8, new_order);
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Frees a block of memory, merging it with its buddy for as long as the
+     * buddy is free as well
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (owns(block))
+        {
+            u64 leaf = leaf_of(block.data);
+            u64 order = order_of(block.size);
+
+            while (order + 1 < ORDER_COUNT)
+            {
+                u64 buddy = leaf ^ (cast(u64, 1) << order);
+                if (not is_free(buddy, order))
+                {
+                    break;
+                }
+
+                remove_free(buddy, order);
+                leaf = leaf < buddy ? leaf : buddy;
+                order++;
+            }
+            push_free(leaf, order);
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        byte * data = cast(byte *, block.data);
+        return data >= region_ and data < region_ + Size and region_ != null;
+    }
+
+    implicit BuddyAllocator & operator=(BuddyAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor, which requests the region and the order of every
+     * leaf from the parent allocator
+     *
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit BuddyAllocator(P * parent = P::instance()) : parent_(parent)
+    {
+        mem::Block region = parent_->allocate(Size, MinBlock);
+        mem::Block orders = parent_->allocate(LEAF_COUNT);
+        if (not region or not orders)
+        {
+            parent_->deallocate(region);
+            parent_->deallocate(orders);
+            return;
+        }
+
+        region_ = cast(byte *, region.data);
+        orders_ = cast(u8 *, orders.data);
+        for (u64 leaf = 0; leaf < LEAF_COUNT; ++leaf)
+        {
+            orders_[leaf] = 0;
+        }
+        push_free(0, ORDER_COUNT - 1);
+    }
+
+    implicit BuddyAllocator(BuddyAllocator const & other) = delete;
+
+    /**
+     * @brief Returns the region and its bookkeeping to the parent allocator
+     */
+    implicit ~BuddyAllocator()
+    {
+        if (region_ != null)
+        {
+            mem::Block region { region_, Size };
+            mem::Block orders { orders_, LEAF_COUNT };
+            parent_->deallocate(region);
+            parent_->deallocate(orders);
+        }
+    }
+};
+}
\ No newline at end of file
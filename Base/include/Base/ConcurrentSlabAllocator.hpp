@@ -0,0 +1,596 @@
+/**
+ * @file ConcurrentSlabAllocator.hpp
+ * @brief Thread-safe allocator of fixed size blocks built on a lock-free stack
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Serves blocks of up to `Size` bytes to any number of threads from a shared
+ * lock-free stack of free slots, refilled with slabs from a parent allocator
+ *
+ * Every operation on the allocator itself is a single compare-and-swap on a stack head,
+ * threads which allocate often should go through their own
+ * `ConcurrentSlabAllocator::Magazine` instead. Magazines take and return whole batches
+ * of `M / 2` slots with a single exchange on a second stack, so they only touch shared
+ * state about once every `M / 2` operations and never take more than one batch at once
+ *
+ * Ownership is decided by size alone, so no other allocator composed with this one may
+ * hand out blocks of up to `Size` bytes, which is why `mem::FallbackAllocator` refuses
+ * it as its primary allocator
+ *
+ * @tparam Size Largest request size served by this allocator
+ * @tparam P Type of allocator which provides slabs, has to be thread-safe
+ * @tparam S Number of slots requested from the parent allocator at once
+ * @tparam M Number of slots a magazine holds before returning half of them
+ */
+template <u64 Size, typename P = mem::SystemAllocator, u64 S = 256, u64 M = 64>
+struct ConcurrentSlabAllocator
+{
+private:
+    struct Node
+    {
+        Node * next;
+        Node * next_batch;
+    };
+
+    struct Slab
+    {
+        Slab * next;
+        u64 size;
+    };
+
+    // NOTE:
+    //   The tag changes with every successful exchange, so a node which is popped and
+    //   pushed back in between loading the head and swapping it cannot be mistaken for
+    //   an unchanged head (ABA). Exchanging both halves at once needs `cmpxchg16b`
+    struct alignas(16) Head
+    {
+        Node * node;
+        u64 tag;
+    };
+
+    static_assert(Size > 0, "Slots must not be empty");
+    static_assert(S > 0, "Slabs must contain at least one slot");
+    static_assert(M >= 2, "Magazines must be able to hold at least two slots");
+
+    // NOTE:
+    //   The first slot of every slab holds the slab header, so it can be returned to the
+    //   parent allocator later
+    constant u64 SLOT_SIZE = mem::align_up(Size < sizeof(Slab) ? sizeof(Slab) : Size, 16);
+    constant u64 SLAB_SIZE = SLOT_SIZE * (S + 1);
+    constant u64 SLOT_ALIGNMENT = SLOT_SIZE & (~SLOT_SIZE + 1);
+    constant u64 BATCH_COUNT = M / 2;
+
+    // NOTE:
+    //   `nodes_` is a stack of single slots linked through `Node::next`, `batches_` is a
+    //   stack of chains of exactly `BATCH_COUNT` slots, which are linked through
+    //   `Node::next` and terminated with null, whose first slots are linked through
+    //   `Node::next_batch`
+    Head nodes_ {};
+    Head batches_ {};
+    Slab * slabs_ = null;
+    P * parent_ = null;
+
+    /**
+     * @return A snapshot of `head`, which may be torn but is validated by the following
+     * exchange
+     */
+    static macro Head load_head(Head & head)
+    {
+        Head snapshot;
+        snapshot.tag = __atomic_load_n(&head.tag, __ATOMIC_ACQUIRE);
+        snapshot.node = __atomic_load_n(&head.node, __ATOMIC_ACQUIRE);
+        return snapshot;
+    }
+
+    /**
+     * @brief Replaces `head` with `node` if it still equals `expected`, which is updated
+     * to the current head otherwise
+     */
+    static macro bool exchange_head(Head & head, Head & expected, Node * node)
+    {
+        Head desired { node, expected.tag + 1 };
+        return __atomic_compare_exchange(
+            &head,
+            &expected,
+            &desired,
+            false,
+            __ATOMIC_ACQ_REL,
+            __ATOMIC_ACQUIRE
+        );
+    }
+
+    /**
+     * @brief Pushes a chain of nodes, already linked through `link` from `first` to
+     * `last`, onto the stack at `head` at once
+     */
+    static void push(Head & head, Node * Node::*link, Node * first, Node * last)
+    {
+        Head expected = load_head(head);
+        do
+        {
+            // NOTE:
+            //   A popper holding a stale head may read the link of `last` at the same time
+            __atomic_store_n(&(last->*link), expected.node, __ATOMIC_RELAXED);
+        } while (not exchange_head(head, expected, first));
+    }
+
+    /**
+     * @return The top node of the stack at `head`, whose nodes are linked through `link`,
+     * or null if it is empty
+     */
+    static Node * pop(Head & head, Node * Node::*link)
+    {
+        Head expected = load_head(head);
+        while (expected.node != null)
+        {
+            // NOTE:
+            //   Slabs are only returned to the parent in the destructor, so the node can
+            //   always be read even if another thread has popped it in the meantime, in
+            //   which case the tag has changed and the exchange fails
+            Node * next = __atomic_load_n(&(expected.node->*link), __ATOMIC_RELAXED);
+            if (exchange_head(head, expected, next))
+            {
+                return expected.node;
+            }
+        }
+        return null;
+    }
+
+    /**
+     * @return A free node, taken from the stack of single nodes, split off of a batch when
+     * that is empty or taken from a new slab when both are, or null if the parent
+     * allocator could not provide a slab
+     */
+    Node * take()
+    {
+        Node * node = pop(nodes_, &Node::next);
+        if (node != null)
+        {
+            return node;
+        }
+
+        node = pop(batches_, &Node::next_batch);
+        if (node == null)
+        {
+            return refill();
+        }
+
+        if (node->next != null)
+        {
+            Node * last = node->next;
+            while (last->next != null)
+            {
+                last = last->next;
+            }
+            push(nodes_, &Node::next, node->next, last);
+        }
+        return node;
+    }
+
+    /**
+     * @brief Requests a new slab from the parent, keeps its first slot and pushes the
+     * rest onto the stacks, in whole batches as far as possible
+     *
+     * @return A free node, or null if the parent allocator could not provide a slab
+     */
+    Node * refill()
+    {
+        mem::Block block = parent_->allocate(SLAB_SIZE, SLOT_ALIGNMENT);
+        if (not block)
+        {
+            return null;
+        }
+
+        Slab * slab = cast(Slab *, block.data);
+        slab->size = block.size;
+        slab->next = __atomic_load_n(&slabs_, __ATOMIC_RELAXED);
+        while (not __atomic_compare_exchange_n(
+            &slabs_,
+            &slab->next,
+            slab,
+            true,
+            __ATOMIC_RELEASE,
+            __ATOMIC_RELAXED
+        ))
+        {
+        }
+
+        auto slot = [&](u64 idx) {
+            return cast(Node *, cast(byte *, block.data) + (idx + 1) * SLOT_SIZE);
+        };
+
+        auto chain = [&](u64 start, u64 stop) {
+            for (u64 idx = start; idx + 1 < stop; ++idx)
+            {
+                slot(idx)->next = slot(idx + 1);
+            }
+            slot(stop - 1)->next = null;
+        };
+
+        u64 start = 1;
+        for (; start + BATCH_COUNT <= S; start += BATCH_COUNT)
+        {
+            chain(start, start + BATCH_COUNT);
+            push(batches_, &Node::next_batch, slot(start), slot(start));
+        }
+
+        if (start < S)
+        {
+            chain(start, S);
+            push(nodes_, &Node::next, slot(start), slot(S - 1));
+        }
+        return slot(0);
+    }
+
+    /**
+     * @param size Size of a block
+     * @return Whether a block of this size belongs to the size class
+     */
+    static bool in_class(u64 size)
+    {
+        return size > 0 and size <= Size;
+    }
+
+public:
+    struct Magazine;
+
+    // NOTE:
+    //   See `mem::owns_by_size`
+    constant bool OWNS_BY_SIZE = true;
+
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static ConcurrentSlabAllocator * instance()
+    {
+        static ConcurrentSlabAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, or an empty block if `size` is outside of
+     * the size class or the slots are not aligned enough
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (not in_class(size) or alignment > SLOT_ALIGNMENT)
+        {
+            return mem::Block {};
+        }
+
+        Node * node = take();
+        if (node == null)
+        {
+            return mem::Block {};
+        }
+        return mem::Block { node, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`, which is `Size` for every
+     * size inside of the size class
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return in_class(size) and alignment <= SLOT_ALIGNMENT ? Size : size;
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which succeeds as long as the
+     * new size stays inside of the size class
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not block or not in_class(size))
+        {
+            return false;
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Pushes a block of memory back onto the shared stack
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (block)
+        {
+            Node * node = cast(Node *, block.data);
+            push(nodes_, &Node::next, node, node);
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return block and in_class(block.size);
+    }
+
+    implicit ConcurrentSlabAllocator & operator=(ConcurrentSlabAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     *
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit ConcurrentSlabAllocator(P * parent = P::instance()) : parent_(parent)
+    {
+    }
+
+    implicit ConcurrentSlabAllocator(ConcurrentSlabAllocator const & other) = delete;
+
+    /**
+     * @brief Returns every slab to the parent allocator, no thread may use the
+     * allocator or one of its magazines anymore
+     */
+    implicit ~ConcurrentSlabAllocator()
+    {
+        while (slabs_ != null)
+        {
+            Slab * slab = slabs_;
+            slabs_ = slab->next;
+
+            mem::Block block { slab, slab->size };
+            parent_->deallocate(block);
+        }
+    }
+};
+
+/**
+ * @brief Single-threaded cache of free slots in front of a shared
+ * `mem::ConcurrentSlabAllocator`, every thread is meant to own one
+ *
+ * Slots freed by one thread may be allocated by another, so blocks can be handed off
+ * between threads freely as long as every magazine uses the same allocator
+ */
+template <u64 Size, typename P, u64 S, u64 M>
+struct ConcurrentSlabAllocator<Size, P, S, M>::Magazine
+{
+private:
+    ConcurrentSlabAllocator * shared_ = null;
+    Node * free_ = null;
+    u64 count_ = 0;
+
+    /**
+     * @brief Takes a whole batch from the shared allocator with a single exchange, or
+     * up to a batch of single slots if there is none, and requests a new slab only when
+     * the shared allocator has no free slots at all
+     */
+    void refill()
+    {
+        Node * batch = pop(shared_->batches_, &Node::next_batch);
+        if (batch != null)
+        {
+            Node * last = batch;
+            while (last->next != null)
+            {
+                last = last->next;
+            }
+            last->next = free_;
+            free_ = batch;
+            count_ += BATCH_COUNT;
+            return;
+        }
+
+        while (count_ < BATCH_COUNT)
+        {
+            Node * node = pop(shared_->nodes_, &Node::next);
+            if (node == null)
+            {
+                break;
+            }
+
+            node->next = free_;
+            free_ = node;
+            count_++;
+        }
+
+        if (free_ == null)
+        {
+            // NOTE:
+            //   The rest of the new slab has been pushed onto the shared stacks
+            Node * node = shared_->refill();
+            if (node != null)
+            {
+                node->next = null;
+                free_ = node;
+                count_++;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns `count` slots to the shared allocator with a single exchange, as a
+     * whole batch if there are exactly `BATCH_COUNT` of them
+     */
+    void flush(u64 count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        Node * first = free_;
+        Node * last = first;
+        for (u64 idx = 1; idx < count; ++idx)
+        {
+            last = last->next;
+        }
+
+        free_ = last->next;
+        count_ -= count;
+
+        if (count == BATCH_COUNT)
+        {
+            last->next = null;
+            push(shared_->batches_, &Node::next_batch, first, first);
+        }
+        else
+        {
+            push(shared_->nodes_, &Node::next, first, last);
+        }
+    }
+
+public:
+    // NOTE:
+    //   See `mem::owns_by_size`
+    constant bool OWNS_BY_SIZE = true;
+
+    /**
+     * @return Always null, magazines belong to a single thread and have no global
+     * instance
+     */
+    static Magazine * instance()
+    {
+        return null;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, or an empty block if `size` is outside of
+     * the size class or the slots are not aligned enough
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (not in_class(size) or alignment > SLOT_ALIGNMENT)
+        {
+            return mem::Block {};
+        }
+
+        if (free_ == null)
+        {
+            refill();
+            if (free_ == null)
+            {
+                return mem::Block {};
+            }
+        }
+
+        Node * node = free_;
+        free_ = node->next;
+        count_--;
+        return mem::Block { node, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return shared_->good_size(size, alignment);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which succeeds as long as the
+     * new size stays inside of the size class
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        return shared_->reallocate(block, size);
+    }
+
+    /**
+     * @brief Keeps a block of memory in the magazine, returning half of the magazine to
+     * the shared stack once it is full
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (block)
+        {
+            if (count_ == M)
+            {
+                flush(BATCH_COUNT);
+            }
+
+            Node * node = cast(Node *, block.data);
+            node->next = free_;
+            free_ = node;
+            count_++;
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return shared_->owns(block);
+    }
+
+    implicit Magazine & operator=(Magazine const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     *
+     * @param shared Pointer to the allocator shared between threads
+     */
+    implicit Magazine(ConcurrentSlabAllocator * shared = ConcurrentSlabAllocator::instance())
+        : shared_(shared)
+    {
+    }
+
+    implicit Magazine(Magazine const & other) = delete;
+
+    /**
+     * @brief Returns every cached slot to the shared stack
+     */
+    implicit ~Magazine()
+    {
+        flush(count_);
+    }
+};
+}
\ No newline at end of file
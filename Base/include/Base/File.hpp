@@ -29,6 +29,7 @@ public:
 
     void open(char * filename);
     void close();
+    bool is_open() const;
 
     i64 exact_size();
     i64 read(std::Span<byte> data, i64 offset);
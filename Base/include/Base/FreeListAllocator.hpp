@@ -0,0 +1,411 @@
+/**
+ * @file FreeListAllocator.hpp
+ * @brief Allocator which recycles blocks of a single size class
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Serves requests between `Min` and `Max` bytes from an intrusive list of freed
+ * `Max` byte slots, refilled in batches from a parent allocator
+ *
+ * `owns` checks the size class and then looks up the batch around the block in a small
+ * hash table, so it takes constant time no matter how many batches were requested. The
+ * allocator composes with `mem::ThresholdAllocator<Max + 1, FreeListAllocator, ...>` and
+ * with `mem::FallbackAllocator<FreeListAllocator, ...>`
+ *
+ * Requests inside of the size class which are aligned more strictly than the slots are
+ * refused. Behind a `mem::FallbackAllocator` they end up in the fallback allocator, which
+ * gets them back on deallocation because they lie outside of every batch, while behind a
+ * `mem::ThresholdAllocator` they simply fail
+ *
+ * @tparam Min Smallest request size served by this allocator
+ * @tparam Max Largest request size served by this allocator
+ * @tparam P Type of allocator which provides batches of slots
+ * @tparam B Number of slots requested from the parent allocator at once
+ */
+template <u64 Min, u64 Max, typename P = mem::SystemAllocator, u64 B = 64>
+struct FreeListAllocator
+{
+private:
+    struct Node
+    {
+        Node * next;
+    };
+
+    struct Batch
+    {
+        Batch * next;
+        u64 size;
+    };
+
+    struct Entry
+    {
+        u64 granule;
+        Batch * batch;
+    };
+
+    static_assert(Min <= Max, "Size class must not be empty");
+    static_assert(B > 0, "Batches must contain at least one slot");
+
+    // NOTE:
+    //   The batch header trails the slots of every batch, so it can be returned to the
+    //   parent allocator later without giving up a whole slot for the header
+    constant u64 SLOT_SIZE = mem::align_up(Max < sizeof(Node) ? sizeof(Node) : Max, 16);
+    constant u64 SLOTS_SIZE = SLOT_SIZE * B;
+    constant u64 BATCH_SIZE = SLOTS_SIZE + mem::align_up(sizeof(Batch), mem::DEFAULT_ALIGNMENT);
+
+    // NOTE:
+    //   Batches are requested with this alignment, so every slot shares it as well
+    constant u64 SLOT_ALIGNMENT = SLOT_SIZE & (~SLOT_SIZE + 1);
+
+    // NOTE:
+    //   Addresses are split into granules of at least `BATCH_SIZE` bytes, so every batch
+    //   touches one or two of them and gets an entry in `table_` for each. Any granule is
+    //   touched by at most three batches, which bounds the probes of `owns`
+    constant u64 GRANULE_SHIFT = 64 - __builtin_clzll(BATCH_SIZE - 1);
+    constant u64 MIN_TABLE_CAPACITY = 16;
+
+    P * parent_ = null;
+    Node * free_ = null;
+    Batch * batches_ = null;
+    Entry * table_ = null;
+    u64 table_capacity_ = 0;
+    u64 table_size_ = 0;
+
+    /**
+     * @return Index of the first entry of `table_` to probe for `granule`
+     */
+    macro u64 home_of(u64 granule) const
+    {
+        return ((granule * 0x9E3779B97F4A7C15) >> 32) & (table_capacity_ - 1);
+    }
+
+    /**
+     * @brief Adds an entry to `table_`, which must have room for it
+     */
+    void insert(u64 granule, Batch * batch)
+    {
+        u64 idx = home_of(granule);
+        while (table_[idx].batch != null)
+        {
+            idx = (idx + 1) & (table_capacity_ - 1);
+        }
+        table_[idx] = Entry { granule, batch };
+        table_size_++;
+    }
+
+    /**
+     * @brief Makes sure `table_` stays at most half full after adding `count` entries
+     *
+     * @return Whether the parent allocator could provide a larger table when needed
+     */
+    bool reserve(u64 count)
+    {
+        if ((table_size_ + count) * 2 <= table_capacity_)
+        {
+            return true;
+        }
+
+        u64 capacity = table_capacity_ == 0 ? MIN_TABLE_CAPACITY : table_capacity_ * 2;
+        mem::Block block = parent_->allocate_zeroed(capacity * sizeof(Entry));
+        if (not block)
+        {
+            return false;
+        }
+
+        Entry * old_table = table_;
+        u64 old_capacity = table_capacity_;
+        table_ = cast(Entry *, block.data);
+        table_capacity_ = capacity;
+        table_size_ = 0;
+
+        if (old_table != null)
+        {
+            for (u64 idx = 0; idx < old_capacity; ++idx)
+            {
+                if (old_table[idx].batch != null)
+                {
+                    insert(old_table[idx].granule, old_table[idx].batch);
+                }
+            }
+            mem::Block old_block { old_table, old_capacity * sizeof(Entry) };
+            parent_->deallocate(old_block);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Requests a new batch from the parent and threads its slots into the list
+     *
+     * @return Whether the parent allocator could provide a batch
+     */
+    bool refill()
+    {
+        if (not reserve(2))
+        {
+            return false;
+        }
+
+        mem::Block block = parent_->allocate(BATCH_SIZE, SLOT_ALIGNMENT);
+        if (not block)
+        {
+            return false;
+        }
+
+        byte * slots = cast(byte *, block.data);
+        Batch * batch = cast(Batch *, slots + SLOTS_SIZE);
+        batch->next = batches_;
+        batch->size = block.size;
+        batches_ = batch;
+
+        u64 first = cast(u64, slots) >> GRANULE_SHIFT;
+        u64 last = (cast(u64, batch) - 1) >> GRANULE_SHIFT;
+        insert(first, batch);
+        if (last != first)
+        {
+            insert(last, batch);
+        }
+
+        for (u64 idx = B; idx-- > 0;)
+        {
+            Node * node = cast(Node *, slots + idx * SLOT_SIZE);
+            node->next = free_;
+            free_ = node;
+        }
+        return true;
+    }
+
+    /**
+     * @param size Size of a block
+     * @return Whether a block of this size belongs to the size class
+     */
+    static bool in_class(u64 size)
+    {
+        return size >= Min and size <= Max;
+    }
+
+    /**
+     * @return The first slot of the batch with header `batch`
+     */
+    static macro byte * slots_of(Batch * batch)
+    {
+        return cast(byte *, batch) - SLOTS_SIZE;
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static FreeListAllocator * instance()
+    {
+        static FreeListAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, or an empty block if `size` is outside of
+     * the size class or the slots are not aligned enough
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (not in_class(size) or alignment > SLOT_ALIGNMENT)
+        {
+            return mem::Block {};
+        }
+
+        if (free_ == null and not refill())
+        {
+            return mem::Block {};
+        }
+
+        Node * node = free_;
+        free_ = node->next;
+        return mem::Block { node, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`, which is `Max` for every size
+     * inside of the size class
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return in_class(size) and alignment <= SLOT_ALIGNMENT ? Max : size;
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which succeeds as long as the
+     * new size stays inside of the size class
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not block or not in_class(size))
+        {
+            return false;
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Pops `count` slots off of the free list at once, refilling it as often as
+     * needed
+     *
+     * @param count Number of blocks to allocate
+     * @param size Requested size of every block
+     * @param out Array which receives `count` blocks
+     * @return Number of blocks allocated, zero if `size` is outside of the size class
+     */
+    u64 allocate_batch(u64 count, u64 size, mem::Block * out)
+    {
+        if (not in_class(size))
+        {
+            return 0;
+        }
+
+        for (u64 idx = 0; idx < count; ++idx)
+        {
+            if (free_ == null and not refill())
+            {
+                return idx;
+            }
+
+            Node * node = free_;
+            free_ = node->next;
+            out[idx] = mem::Block { node, size };
+        }
+        return count;
+    }
+
+    /**
+     * @brief Puts a block of memory back in the free list
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (block)
+        {
+            Node * node = cast(Node *, block.data);
+            node->next = free_;
+            free_ = node;
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @brief Links `count` blocks of memory together and puts them back in the free list
+     * with a single splice
+     *
+     * @param blocks Blocks to deallocate
+     * @param count Number of blocks in `blocks`
+     */
+    void deallocate_batch(mem::Block * blocks, u64 count)
+    {
+        Node * head = free_;
+        for (u64 idx = count; idx-- > 0;)
+        {
+            if (blocks[idx])
+            {
+                Node * node = cast(Node *, blocks[idx].data);
+                node->next = head;
+                head = node;
+            }
+            blocks[idx] = mem::Block {};
+        }
+        free_ = head;
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        if (not block or not in_class(block.size))
+        {
+            return false;
+        }
+
+        if (table_ == null)
+        {
+            return false;
+        }
+
+        byte * data = cast(byte *, block.data);
+        u64 granule = cast(u64, data) >> GRANULE_SHIFT;
+        u64 mask = table_capacity_ - 1;
+        for (u64 idx = home_of(granule); table_[idx].batch != null; idx = (idx + 1) & mask)
+        {
+            Entry & entry = table_[idx];
+            if (entry.granule != granule)
+            {
+                continue;
+            }
+
+            if (data >= slots_of(entry.batch) and data < cast(byte *, entry.batch))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    implicit FreeListAllocator & operator=(FreeListAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     *
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit FreeListAllocator(P * parent = P::instance()) : parent_(parent)
+    {
+    }
+
+    implicit FreeListAllocator(FreeListAllocator const & other) = delete;
+
+    /**
+     * @brief Returns every batch and the table to the parent allocator
+     */
+    implicit ~FreeListAllocator()
+    {
+        while (batches_ != null)
+        {
+            Batch * next = batches_->next;
+            mem::Block block { slots_of(batches_), batches_->size };
+            parent_->deallocate(block);
+            batches_ = next;
+        }
+
+        if (table_ != null)
+        {
+            mem::Block block { table_, table_capacity_ * sizeof(Entry) };
+            parent_->deallocate(block);
+        }
+    }
+};
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/**
+ * @file HugePageAllocator.hpp
+ * @brief Allocator which backs large blocks with huge pages
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Rounds every block up to a multiple of the huge page size and aligns it, so
+ * scans over large blocks need fewer TLB entries
+ *
+ * The rounding wastes up to a huge page per block, so the allocator is meant to be the
+ * `B` side of a `mem::ThresholdAllocator`. Like `mem::SystemAllocator`, it claims every
+ * non-empty block
+ */
+struct HugePageAllocator
+{
+private:
+    /**
+     * @param size Size of a block
+     * @return Number of bytes mapped for a block of this size
+     */
+    static u64 mapped_size(u64 size)
+    {
+        return mem::align_up(size == 0 ? 1 : size, sys::huge_page_size());
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static HugePageAllocator * instance()
+    {
+        static HugePageAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, at most the huge page size
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (alignment > cast(u64, sys::huge_page_size()))
+        {
+            return mem::Block {};
+        }
+
+        void * data = sys::allocate_huge_pages(mapped_size(size));
+        if (data != null)
+        {
+            return mem::Block { data, size };
+        }
+        return mem::Block {};
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes, which every block is
+     * since it is mapped from fresh pages
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return allocate(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (alignment > cast(u64, sys::huge_page_size()))
+        {
+            return size;
+        }
+        return mapped_size(size);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which succeeds as long as the
+     * block does not need a different number of huge pages
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not block or mapped_size(size) != mapped_size(block.size))
+        {
+            return false;
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (block)
+        {
+            sys::deallocate_huge_pages(block.data, mapped_size(block.size));
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return block.data != null;
+    }
+};
+}
\ No newline at end of file
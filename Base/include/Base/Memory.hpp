@@ -34,6 +34,246 @@ struct Block
     implicit ~Block() = default;
 };
 
+// NOTE:
+//   Alignment of every block unless a larger alignment is requested explicitly
+constant u64 DEFAULT_ALIGNMENT = 16;
+
+/**
+ * @param size A size in bytes
+ * @param alignment A power of two
+ * @return `size` rounded up to a multiple of `alignment`
+ */
+constexpr macro u64 align_up(u64 size, u64 alignment)
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Fills a block of memory with zeroes
+ *
+ * @param block A block of memory
+ * @return The same block, so the call can wrap `allocate`
+ */
+macro mem::Block zeroed(mem::Block block)
+{
+    byte * data = cast(byte *, block.data);
+    for (u64 idx = 0; idx < block.size; ++idx)
+    {
+        data[idx] = 0;
+    }
+    return block;
+}
+
+// NOTE:
+//   Word sized copies go through a type which may alias anything, the regions usually
+//   hold objects of some other type
+using AliasingWord = u64 __attribute__((may_alias));
+
+/**
+ * @brief Copies `size` bytes between two regions of memory which do not overlap
+ *
+ * @param destination Address to copy to
+ * @param source Address to copy from
+ * @param size Number of bytes to copy
+ */
+macro void copy(void * destination, void const * source, u64 size)
+{
+    byte * to = cast(byte *, destination);
+    byte const * from = cast(byte const *, source);
+
+    // NOTE:
+    //   Word sized copies of aligned regions vectorize into wide loads and stores
+    if (((cast(u64, to) | cast(u64, from)) & (sizeof(u64) - 1)) == 0)
+    {
+        u64 words = size / sizeof(u64);
+        for (u64 idx = 0; idx < words; ++idx)
+        {
+            cast(AliasingWord *, to)[idx] = cast(AliasingWord const *, from)[idx];
+        }
+        to += words * sizeof(u64);
+        from += words * sizeof(u64);
+        size -= words * sizeof(u64);
+    }
+
+    for (u64 idx = 0; idx < size; ++idx)
+    {
+        to[idx] = from[idx];
+    }
+}
+
+/**
+ * @brief Copies `size` bytes between two regions of memory which may overlap
+ *
+ * @param destination Address to copy to
+ * @param source Address to copy from
+ * @param size Number of bytes to copy
+ */
+macro void move(void * destination, void const * source, u64 size)
+{
+    byte * to = cast(byte *, destination);
+    byte const * from = cast(byte const *, source);
+    if (to <= from or to >= from + size)
+    {
+        mem::copy(destination, source, size);
+        return;
+    }
+
+    // NOTE:
+    //   The destination overlaps the end of the source, so copy back to front
+    if (((cast(u64, to) | cast(u64, from) | size) & (sizeof(u64) - 1)) == 0)
+    {
+        for (u64 idx = size / sizeof(u64); idx-- > 0;)
+        {
+            cast(AliasingWord *, to)[idx] = cast(AliasingWord const *, from)[idx];
+        }
+        return;
+    }
+
+    for (u64 idx = size; idx-- > 0;)
+    {
+        to[idx] = from[idx];
+    }
+}
+
+/**
+ * @brief Allocates `count` blocks of `size` bytes with the default alignment, through
+ * `allocator.allocate_batch()` if the allocator has one and one by one otherwise
+ *
+ * @param allocator Any allocator
+ * @param count Number of blocks to allocate
+ * @param size Requested size of every block
+ * @param out Array which receives `count` blocks
+ * @return Number of blocks allocated, the rest of `out` is left untouched
+ */
+template <typename A>
+u64 allocate_batch(A & allocator, u64 count, u64 size, mem::Block * out)
+{
+    if constexpr (requires { allocator.allocate_batch(count, size, out); })
+    {
+        return allocator.allocate_batch(count, size, out);
+    }
+    else
+    {
+        for (u64 idx = 0; idx < count; ++idx)
+        {
+            out[idx] = allocator.allocate(size);
+            if (not out[idx])
+            {
+                return idx;
+            }
+        }
+        return count;
+    }
+}
+
+/**
+ * @brief Deallocates `count` blocks, through `allocator.deallocate_batch()` if the
+ * allocator has one and one by one otherwise
+ *
+ * @param allocator Any allocator
+ * @param blocks Blocks to deallocate, every one of them is invalidated
+ * @param count Number of blocks in `blocks`
+ */
+template <typename A>
+void deallocate_batch(A & allocator, mem::Block * blocks, u64 count)
+{
+    if constexpr (requires { allocator.deallocate_batch(blocks, count); })
+    {
+        allocator.deallocate_batch(blocks, count);
+    }
+    else
+    {
+        for (u64 idx = 0; idx < count; ++idx)
+        {
+            allocator.deallocate(blocks[idx]);
+        }
+    }
+}
+
+/**
+ * @brief Whether `A` decides ownership by the size of a block alone, which it declares
+ * with a static `OWNS_BY_SIZE` member set to true. Such an allocator claims blocks of its
+ * size class even if another allocator handed them out
+ */
+template <typename A>
+constant bool owns_by_size = requires { requires A::OWNS_BY_SIZE; };
+
+/**
+ * @brief An allocator which never succeeds, useful as the parent of allocators which
+ * should never go to the heap
+ */
+struct NullAllocator
+{
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static NullAllocator * instance()
+    {
+        static NullAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An empty block
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::Block {};
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::Block {};
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 = mem::DEFAULT_ALIGNMENT)
+    {
+        return size;
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        assert(not block);
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return false;
+    }
+};
+
 struct SystemAllocator
 {
     /**
@@ -47,11 +287,27 @@ struct SystemAllocator
 
     /**
      * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
      * @return An allocated block of memory
      */
-    mem::Block allocate(u64 size)
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        void * data = sys::allocate(size, alignment);
+        if (data != null)
+        {
+            return mem::Block { data, size };
+        }
+        return mem::Block {};
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
     {
-        void * data = sys::allocate(size);
+        void * data = sys::allocate_zeroed(size, alignment);
         if (data != null)
         {
             return mem::Block { data, size };
@@ -59,6 +315,16 @@ struct SystemAllocator
         return mem::Block {};
     }
 
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return sys::good_size(size, alignment);
+    }
+
     /**
      * @brief Tries to reallocate a block of memory inplace
      *
@@ -87,6 +353,59 @@ struct SystemAllocator
         block = mem::Block {};
     }
 
+    /**
+     * @brief Allocates `count` blocks of `size` bytes, taking the heap lock once per
+     * batch of small blocks
+     *
+     * @param count Number of blocks to allocate
+     * @param size Requested size of every block
+     * @param out Array which receives `count` blocks
+     * @return Number of blocks allocated
+     */
+    u64 allocate_batch(u64 count, u64 size, mem::Block * out)
+    {
+        void * pointers[BATCH_SIZE];
+
+        u64 allocated = 0;
+        while (allocated < count)
+        {
+            u64 requested = count - allocated < BATCH_SIZE ? count - allocated : BATCH_SIZE;
+            u64 received = sys::allocate_batch(requested, size, pointers);
+            for (u64 idx = 0; idx < received; ++idx)
+            {
+                out[allocated++] = mem::Block { pointers[idx], size };
+            }
+
+            if (received < requested)
+            {
+                break;
+            }
+        }
+        return allocated;
+    }
+
+    /**
+     * @brief Destroy and invalidate `count` blocks of memory
+     *
+     * @param blocks Blocks to deallocate
+     * @param count Number of blocks in `blocks`
+     */
+    void deallocate_batch(mem::Block * blocks, u64 count)
+    {
+        void * pointers[BATCH_SIZE];
+
+        for (u64 start = 0; start < count; start += BATCH_SIZE)
+        {
+            u64 length = count - start < BATCH_SIZE ? count - start : BATCH_SIZE;
+            for (u64 idx = 0; idx < length; ++idx)
+            {
+                pointers[idx] = blocks[start + idx].data;
+                blocks[start + idx] = mem::Block {};
+            }
+            sys::deallocate_batch(pointers, length);
+        }
+    }
+
     /**
      * @param block A block of memory
      * @return Whether the block has been allocated by this allocator
@@ -95,32 +414,75 @@ struct SystemAllocator
     {
         return block.data != null;
     }
+
+private:
+    // NOTE:
+    //   Batches are handed to the system in pieces of this many pointers, so they fit on
+    //   the stack
+    constant u64 BATCH_SIZE = 64;
 };
 
 template <typename A, typename B>
 struct FallbackAllocator : private A, private B
 {
+    static_assert(
+        not mem::owns_by_size<A>,
+        "The primary allocator would claim blocks of the fallback allocator on deallocation"
+    );
+
     /**
-     * @return A pointer to the global instance of this allocator
+     * @return A pointer to the global instance of this allocator, or null when one of the
+     * wrapped allocators has no global instance either
      */
     static FallbackAllocator * instance()
     {
+        if (A::instance() == null or B::instance() == null)
+        {
+            return null;
+        }
+
         static FallbackAllocator instance_;
         return &instance_;
     }
 
     /**
      * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
      * @return An allocated block of memory
      */
-    mem::Block allocate(i64 size)
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        mem::Block block = A::allocate(size, alignment);
+        if (block)
+        {
+            return block;
+        }
+        return B::allocate(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
     {
-        mem::Block block = A::allocate(size);
+        mem::Block block = A::allocate_zeroed(size, alignment);
         if (block)
         {
             return block;
         }
-        return B::allocate(size);
+        return B::allocate_zeroed(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`, as rounded by the primary allocator
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return A::good_size(size, alignment);
     }
 
     /**
@@ -130,7 +492,7 @@ struct FallbackAllocator : private A, private B
      * @param size The new requested size of the block
      * @return Whether the allocator was successful in reallocatein the block
      */
-    bool reallocate(mem::Block & block, i64 size)
+    bool reallocate(mem::Block & block, u64 size)
     {
         if (A::owns(block))
         {
@@ -142,6 +504,30 @@ struct FallbackAllocator : private A, private B
         }
     }
 
+    /**
+     * @brief Allocates as many of `count` blocks as possible from the primary allocator
+     * and the rest from the fallback allocator
+     *
+     * @param count Number of blocks to allocate
+     * @param size Requested size of every block
+     * @param out Array which receives `count` blocks
+     * @return Number of blocks allocated
+     */
+    u64 allocate_batch(u64 count, u64 size, mem::Block * out)
+    {
+        u64 allocated = mem::allocate_batch(static_cast<A &>(*this), count, size, out);
+        if (allocated == count)
+        {
+            return allocated;
+        }
+        return allocated + mem::allocate_batch(
+            static_cast<B &>(*this),
+            count - allocated,
+            size,
+            out + allocated
+        );
+    }
+
     /**
      * @brief Destroy and invalidate a block of memory
      *
@@ -159,6 +545,38 @@ struct FallbackAllocator : private A, private B
         }
     }
 
+    /**
+     * @brief Destroy and invalidate `count` blocks of memory, handing every run of blocks
+     * of the same allocator over at once
+     *
+     * @param blocks Blocks to deallocate
+     * @param count Number of blocks in `blocks`
+     */
+    void deallocate_batch(mem::Block * blocks, u64 count)
+    {
+        u64 start = 0;
+        while (start < count)
+        {
+            bool primary = A::owns(blocks[start]);
+
+            u64 stop = start + 1;
+            while (stop < count and A::owns(blocks[stop]) == primary)
+            {
+                stop++;
+            }
+
+            if (primary)
+            {
+                mem::deallocate_batch(static_cast<A &>(*this), blocks + start, stop - start);
+            }
+            else
+            {
+                mem::deallocate_batch(static_cast<B &>(*this), blocks + start, stop - start);
+            }
+            start = stop;
+        }
+    }
+
     /**
      * @param block A block of memory
      * @return Whether the block has been allocated by this allocator
@@ -173,27 +591,71 @@ template <u64 T, typename A, typename B>
 struct ThresholdAllocator : private A, private B
 {
     /**
-     * @return A pointer to the global instance of this allocator
+     * @return A pointer to the global instance of this allocator, or null when one of the
+     * wrapped allocators has no global instance either
      */
     static ThresholdAllocator * instance()
     {
+        if (A::instance() == null or B::instance() == null)
+        {
+            return null;
+        }
+
         static ThresholdAllocator instance_;
         return &instance_;
     }
 
     /**
      * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
      * @return An allocated block of memory
      */
-    mem::Block allocate(i64 size)
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
     {
         if (size < T)
         {
-            return A::allocate(size);
+            return A::allocate(size, alignment);
         }
         else
         {
-            return B::allocate(size);
+            return B::allocate(size, alignment);
+        }
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (size < T)
+        {
+            return A::allocate_zeroed(size, alignment);
+        }
+        else
+        {
+            return B::allocate_zeroed(size, alignment);
+        }
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (size < T)
+        {
+            // NOTE:
+            //   Rounding up must not push a request over to the other allocator
+            u64 good = A::good_size(size, alignment);
+            return good < T ? good : size;
+        }
+        else
+        {
+            return B::good_size(size, alignment);
         }
     }
 
@@ -204,7 +666,7 @@ struct ThresholdAllocator : private A, private B
      * @param size The new requested size of the block
      * @return Whether the allocator was successful in reallocatein the block
      */
-    bool reallocate(mem::Block & block, i64 size)
+    bool reallocate(mem::Block & block, u64 size)
     {
         if (block.size < T)
         {
@@ -223,6 +685,24 @@ struct ThresholdAllocator : private A, private B
         }
     }
 
+    /**
+     * @param count Number of blocks to allocate
+     * @param size Requested size of every block
+     * @param out Array which receives `count` blocks
+     * @return Number of blocks allocated
+     */
+    u64 allocate_batch(u64 count, u64 size, mem::Block * out)
+    {
+        if (size < T)
+        {
+            return mem::allocate_batch(static_cast<A &>(*this), count, size, out);
+        }
+        else
+        {
+            return mem::allocate_batch(static_cast<B &>(*this), count, size, out);
+        }
+    }
+
     /**
      * @brief Destroy and invalidate a block of memory
      *
@@ -240,6 +720,38 @@ struct ThresholdAllocator : private A, private B
         }
     }
 
+    /**
+     * @brief Destroy and invalidate `count` blocks of memory, handing every run of blocks
+     * on the same side of the threshold over at once
+     *
+     * @param blocks Blocks to deallocate
+     * @param count Number of blocks in `blocks`
+     */
+    void deallocate_batch(mem::Block * blocks, u64 count)
+    {
+        u64 start = 0;
+        while (start < count)
+        {
+            bool small = blocks[start].size < T;
+
+            u64 stop = start + 1;
+            while (stop < count and (blocks[stop].size < T) == small)
+            {
+                stop++;
+            }
+
+            if (small)
+            {
+                mem::deallocate_batch(static_cast<A &>(*this), blocks + start, stop - start);
+            }
+            else
+            {
+                mem::deallocate_batch(static_cast<B &>(*this), blocks + start, stop - start);
+            }
+            start = stop;
+        }
+    }
+
     /**
      * @param block A block of memory
      * @return Whether the block has been allocated by this allocator
@@ -256,4 +768,242 @@ struct ThresholdAllocator : private A, private B
         }
     }
 };
+
+/**
+ * @brief Ascending power of two size thresholds for `mem::Segregator`, which maps a size
+ * to its size class with a bit scan and a table lookup
+ *
+ * @tparam Ts Ascending power of two thresholds
+ */
+template <u64... Ts>
+struct Thresholds
+{
+private:
+    struct ClassTable
+    {
+        u8 classes[65];
+    };
+
+    static constexpr bool VALID = [] {
+        u64 thresholds[] = { Ts..., 0 };
+        for (u64 idx = 0; idx < sizeof...(Ts); ++idx)
+        {
+            u64 threshold = thresholds[idx];
+            if (threshold == 0 or (threshold & (threshold - 1)) != 0)
+            {
+                return false;
+            }
+            if (idx > 0 and threshold <= thresholds[idx - 1])
+            {
+                return false;
+            }
+        }
+        return true;
+    }();
+
+    static_assert(VALID, "Thresholds must be ascending powers of two");
+
+    static constexpr ClassTable CLASSES = [] {
+        u64 thresholds[] = { Ts..., 0 };
+
+        ClassTable table {};
+        for (u64 width = 0; width <= 64; ++width)
+        {
+            // NOTE:
+            //   A size of bit width `w` is at least `2^(w - 1)`, which means it is past
+            //   every threshold `2^k` where `k < w`
+            u8 index = 0;
+            for (u64 idx = 0; idx < sizeof...(Ts); ++idx)
+            {
+                index += width > cast(u64, 63 - __builtin_clzll(thresholds[idx]));
+            }
+            table.classes[width] = index;
+        }
+        return table;
+    }();
+
+public:
+    constant u64 COUNT = sizeof...(Ts);
+
+    /**
+     * @param size Size of a block
+     * @return Number of thresholds that `size` is greater than or equal to
+     */
+    static macro u64 class_of(u64 size)
+    {
+        u64 width = size == 0 ? 0 : 64 - __builtin_clzll(size);
+        return CLASSES.classes[width];
+    }
+};
+
+template <typename S, typename... As>
+struct Segregator;
+
+/**
+ * @brief Generalization of `mem::ThresholdAllocator` to any number of size classes
+ *
+ * Blocks smaller than the first threshold go to the first allocator, blocks between the
+ * first and second threshold go to the second allocator and so on
+ *
+ * @tparam Ts Ascending power of two thresholds
+ * @tparam As One more allocator than there are thresholds
+ */
+template <u64... Ts, typename... As>
+struct Segregator<mem::Thresholds<Ts...>, As...>
+{
+private:
+    using Classes = mem::Thresholds<Ts...>;
+
+    static_assert(sizeof...(As) == Classes::COUNT + 1, "Expected one allocator per class");
+
+    /**
+     * @brief Wrapper which keeps allocators of the same type apart
+     */
+    template <u64 I, typename A>
+    struct Slot : A
+    {
+    };
+
+    template <typename Is>
+    struct Slots;
+
+    template <u64... Is>
+    struct Slots<meta::index_sequence<Is...>> : Slot<Is, As>...
+    {
+    };
+
+    using Indices = meta::make_index_sequence<sizeof...(As)>;
+
+    Slots<Indices> slots_;
+
+    /**
+     * @return The allocator responsible for size class `I`
+     */
+    template <u64 I, typename A>
+    macro A & slot()
+    {
+        Slot<I, A> & slot = slots_;
+        return slot;
+    }
+
+    /**
+     * @brief Calls `f` with the allocator responsible for size class `index`
+     */
+    template <typename F, u64... Is>
+    macro auto dispatch(u64 index, F && f, meta::index_sequence<Is...>)
+    {
+        decltype((f(slot<Is, As>()), ...)) result {};
+        (void)((index == Is ? (result = f(slot<Is, As>()), true) : false) or ...);
+        return result;
+    }
+
+    template <typename F>
+    macro auto dispatch(u64 index, F && f)
+    {
+        return dispatch(index, f, Indices {});
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator, or null when one of the
+     * wrapped allocators has no global instance either
+     */
+    static Segregator * instance()
+    {
+        if (((As::instance() == null) or ...))
+        {
+            return null;
+        }
+
+        static Segregator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return dispatch(Classes::class_of(size), [&](auto & allocator) {
+            return allocator.allocate(size, alignment);
+        });
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return dispatch(Classes::class_of(size), [&](auto & allocator) {
+            return allocator.allocate_zeroed(size, alignment);
+        });
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        u64 index = Classes::class_of(size);
+        return dispatch(index, [&](auto & allocator) {
+            // NOTE:
+            //   Rounding up must not push a request over to another size class
+            u64 good = allocator.good_size(size, alignment);
+            return Classes::class_of(good) == index ? good : size;
+        });
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        u64 index = Classes::class_of(block.size);
+
+        // NOTE:
+        //   Do not allow a block to reallocate into another size class!
+        if (index != Classes::class_of(size))
+        {
+            return false;
+        }
+
+        return dispatch(index, [&](auto & allocator) {
+            return allocator.reallocate(block, size);
+        });
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        dispatch(Classes::class_of(block.size), [&](auto & allocator) {
+            allocator.deallocate(block);
+            return true;
+        });
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return dispatch(Classes::class_of(block.size), [&](auto & allocator) {
+            return allocator.owns(block);
+        });
+    }
+};
 }
\ No newline at end of file
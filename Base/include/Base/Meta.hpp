@@ -16,4 +16,20 @@ concept readonly = std::is_const<std::noref_t<T>>;
 
 template <typename T>
 concept not_readonly = not std::is_const<std::noref_t<T>>;
+
+template <u64... Is>
+struct index_sequence
+{
+};
+
+template <typename T, T... Is>
+using integer_sequence_adapter = index_sequence<Is...>;
+
+#if defined(__clang__)
+template <u64 N>
+using make_index_sequence = __make_integer_seq<integer_sequence_adapter, u64, N>;
+#else
+template <u64 N>
+using make_index_sequence = index_sequence<__integer_pack(N)...>;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,243 @@
+/**
+ * @file ObjectPool.hpp
+ * @brief Typed pool which constructs objects in slots carved out of slabs
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Constructs objects of type `T` in slots of `S` byte slabs requested from a
+ * parent allocator and recycles the slots of destroyed objects
+ *
+ * Slabs are aligned to their size, so the slab of an object is found by masking its
+ * address, and every slab tracks its live slots in a bitmap so that
+ * `ObjectPool::destroy_all()` can run every destructor at once
+ *
+ * @tparam T Type of pooled objects
+ * @tparam A Type of allocator which provides slabs
+ * @tparam S Size of a slab, a power of two
+ */
+template <typename T, typename A = mem::SystemAllocator, u64 S = 64 * 1024>
+struct ObjectPool
+{
+private:
+    struct Node
+    {
+        Node * next;
+    };
+
+    constant u64 SLOT_ALIGNMENT = alignof(T) > alignof(Node) ? alignof(T) : alignof(Node);
+    constant u64 SLOT_SIZE = mem::align_up(
+        sizeof(T) > sizeof(Node) ? sizeof(T) : sizeof(Node),
+        SLOT_ALIGNMENT
+    );
+
+    // NOTE:
+    //   The bitmap is sized for a slab without a header, which is always enough
+    constant u64 WORD_COUNT = S / SLOT_SIZE / 64 + 1;
+
+    struct Slab
+    {
+        Slab * next;
+        u64 live[WORD_COUNT];
+    };
+
+    constant u64 HEADER_SIZE = mem::align_up(sizeof(Slab), SLOT_ALIGNMENT);
+    constant u64 SLOT_COUNT = S > HEADER_SIZE ? (S - HEADER_SIZE) / SLOT_SIZE : 0;
+
+    static_assert((S & (S - 1)) == 0, "Slab size must be a power of two");
+    static_assert(SLOT_COUNT > 0, "Slabs must hold at least one object");
+
+    A * parent_ = null;
+    Slab * slabs_ = null;
+    Node * free_ = null;
+    u64 size_ = 0;
+
+    /**
+     * @return The slab which holds `object`
+     */
+    static macro Slab * slab_of(void * object)
+    {
+        return cast(Slab *, cast(u64, object) & ~(S - 1));
+    }
+
+    /**
+     * @return The slot at index `index` of `slab`
+     */
+    static macro T * slot_of(Slab * slab, u64 index)
+    {
+        return cast(T *, cast(byte *, slab) + HEADER_SIZE + index * SLOT_SIZE);
+    }
+
+    /**
+     * @return Index of the slot of `object` inside of its slab
+     */
+    static macro u64 index_of(void * object)
+    {
+        return (cast(u64, object) - cast(u64, slab_of(object)) - HEADER_SIZE) / SLOT_SIZE;
+    }
+
+    /**
+     * @brief Threads every slot of `slab` into the free list, lowest address first
+     */
+    void free_slots(Slab * slab)
+    {
+        for (u64 index = SLOT_COUNT; index-- > 0;)
+        {
+            Node * node = cast(Node *, slot_of(slab, index));
+            node->next = free_;
+            free_ = node;
+        }
+    }
+
+    /**
+     * @brief Requests a new slab from the parent allocator
+     *
+     * @return Whether the parent allocator could provide a slab
+     */
+    bool grow()
+    {
+        mem::Block block = parent_->allocate(S, S);
+        if (not block)
+        {
+            return false;
+        }
+
+        Slab * slab = cast(Slab *, block.data);
+        slab->next = slabs_;
+        for (u64 word = 0; word < WORD_COUNT; ++word)
+        {
+            slab->live[word] = 0;
+        }
+        slabs_ = slab;
+
+        free_slots(slab);
+        return true;
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this pool
+     */
+    static ObjectPool * instance()
+    {
+        static ObjectPool instance_;
+        return &instance_;
+    }
+
+    /**
+     * @return Number of live objects in the pool
+     */
+    u64 size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Constructs an object in a free slot
+     *
+     * @param args Arguments, forwarded to the new object's constructor
+     * @return A pointer to the new object, or null if the parent allocator is out of
+     * memory
+     */
+    template <typename... Ts>
+    T * create(Ts &&... args)
+    {
+        if (free_ == null and not grow())
+        {
+            return null;
+        }
+
+        Node * node = free_;
+        free_ = node->next;
+
+        u64 index = index_of(node);
+        slab_of(node)->live[index / 64] |= cast(u64, 1) << (index % 64);
+        size_++;
+
+        return new (node) T(std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Destroys an object created by this pool and recycles its slot
+     *
+     * @param object The object to destroy, may be null
+     */
+    void destroy(T * object)
+    {
+        if (object == null)
+        {
+            return;
+        }
+
+        object->~T();
+
+        u64 index = index_of(object);
+        slab_of(object)->live[index / 64] &= ~(cast(u64, 1) << (index % 64));
+        size_--;
+
+        Node * node = cast(Node *, object);
+        node->next = free_;
+        free_ = node;
+    }
+
+    /**
+     * @brief Destroys every live object at once, keeping the slabs around for new
+     * objects
+     */
+    void destroy_all()
+    {
+        free_ = null;
+        for (Slab * slab = slabs_; slab != null; slab = slab->next)
+        {
+            for (u64 word = 0; word < WORD_COUNT; ++word)
+            {
+                u64 live = slab->live[word];
+                while (live != 0)
+                {
+                    u64 index = word * 64 + __builtin_ctzll(live);
+                    slot_of(slab, index)->~T();
+                    live &= live - 1;
+                }
+                slab->live[word] = 0;
+            }
+            free_slots(slab);
+        }
+        size_ = 0;
+    }
+
+    implicit ObjectPool & operator=(ObjectPool const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     *
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit ObjectPool(A * parent = A::instance()) : parent_(parent)
+    {
+    }
+
+    implicit ObjectPool(ObjectPool const & other) = delete;
+
+    /**
+     * @brief Destroys every live object and returns every slab to the parent allocator
+     */
+    implicit ~ObjectPool()
+    {
+        destroy_all();
+        while (slabs_ != null)
+        {
+            Slab * slab = slabs_;
+            slabs_ = slab->next;
+
+            mem::Block block { slab, S };
+            parent_->deallocate(block);
+        }
+    }
+};
+}
\ No newline at end of file
@@ -0,0 +1,219 @@
+/**
+ * @file ScratchAllocator.hpp
+ * @brief Arena with checkpoints for short lived temporaries
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief A `mem::ArenaAllocator` which can roll back to an earlier checkpoint, releasing
+ * every block allocated since then at once
+ *
+ * Like the arena, only the most recent block can be reallocated inplace or reclaimed by
+ * `deallocate`. A processing stage takes a `ScratchAllocator::mark()` (or opens a
+ * `ScratchAllocator::Scope`), allocates as many temporaries as it needs and restores the
+ * mark when it is done
+ *
+ * @tparam P Type of allocator which provides chunks
+ * @tparam C Minimum size of a chunk requested from the parent allocator
+ */
+template <typename P = mem::SystemAllocator, u64 C = 64 * 1024>
+struct ScratchAllocator : private mem::ArenaAllocator<P, C>
+{
+private:
+    using Base = mem::ArenaAllocator<P, C>;
+    using Chunk = typename Base::Chunk;
+
+public:
+    /**
+     * @brief Position of the scratch allocator at the time of `ScratchAllocator::mark()`
+     */
+    struct Marker
+    {
+        Chunk * chunk;
+        byte * cursor;
+    };
+
+    /**
+     * @brief Rolls its scratch allocator back to where it was when the scope was opened
+     *
+     * Declare the scope before the containers which use the scratch allocator, so they
+     * are destroyed while their blocks are still valid
+     */
+    struct Scope
+    {
+    private:
+        ScratchAllocator * scratch_;
+        Marker marker_;
+
+    public:
+        implicit Scope & operator=(Scope const & other) = delete;
+
+        /**
+         * @brief Opens a scope by marking the current position of `scratch`
+         */
+        implicit Scope(ScratchAllocator & scratch) :
+            scratch_(&scratch),
+            marker_(scratch.mark())
+        {
+        }
+
+        implicit Scope(Scope const & other) = delete;
+
+        /**
+         * @brief Releases every block allocated during the scope
+         */
+        implicit ~Scope()
+        {
+            scratch_->rollback(marker_);
+        }
+    };
+
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static ScratchAllocator * instance()
+    {
+        static ScratchAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @return A checkpoint of the current position, to be passed to
+     * `ScratchAllocator::rollback()`
+     */
+    Marker mark() const
+    {
+        return Marker { this->current_, this->cursor_ };
+    }
+
+    /**
+     * @brief Invalidates every block allocated since `marker` was taken and returns the
+     * chunks allocated since then to the parent allocator
+     *
+     * Markers have to be rolled back in LIFO order, rolling back to a marker invalidates
+     * every marker taken after it
+     *
+     * @param marker A checkpoint taken by `ScratchAllocator::mark()`
+     */
+    void rollback(Marker marker)
+    {
+        if (marker.chunk == null)
+        {
+            Base::reset();
+            return;
+        }
+
+        while (this->current_ != marker.chunk)
+        {
+            Chunk * previous = this->current_->previous;
+            this->release_chunk(this->current_);
+            this->current_ = previous;
+        }
+
+        this->use_chunk(marker.chunk);
+        this->cursor_ = marker.cursor;
+    }
+
+    /**
+     * @brief Invalidates every block at once, see `mem::ArenaAllocator::reset()`
+     */
+    void reset()
+    {
+        Base::reset();
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return Base::allocate(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return Base::allocate_zeroed(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return Base::good_size(size, alignment);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which only succeeds for the
+     * most recent block or when shrinking
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        return Base::reallocate(block, size);
+    }
+
+    /**
+     * @brief Invalidates a block of memory, which is only reclaimed if it is the most
+     * recent block
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        Base::deallocate(block);
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return Base::owns(block);
+    }
+
+    implicit ScratchAllocator & operator=(ScratchAllocator const & other) = delete;
+
+    /**
+     * @brief Constructs a scratch allocator which requests chunks from `parent` on demand
+     *
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit ScratchAllocator(P * parent = P::instance()) : Base(parent)
+    {
+    }
+
+    /**
+     * @brief Constructs a scratch allocator which uses `buffer` before requesting any
+     * chunks from `parent`, the buffer is never released
+     *
+     * @param buffer Memory to carve allocations out of, must outlive the allocator
+     * @param parent Pointer to parent allocator instance
+     */
+    implicit ScratchAllocator(mem::Block buffer, P * parent = P::instance()) :
+        Base(buffer, parent)
+    {
+    }
+
+    implicit ScratchAllocator(ScratchAllocator const & other) = delete;
+};
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+/**
+ * @file SmallVector.hpp
+ * @brief A dynamic array which keeps its first few objects inside of itself
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace std
+{
+/**
+ * @brief Allocator of `std::SmallVector`, which hands out its inline buffer of `N`
+ * objects of type `T` when it is free and large enough and forwards everything else to
+ * the parent allocator
+ *
+ * @tparam T Type of underlying objects
+ * @tparam N Number of objects which fit in the inline buffer
+ * @tparam A Type of allocator to spill to
+ */
+template <typename T, u64 N, typename A = mem::SystemAllocator>
+struct SmallVectorAllocator
+{
+protected:
+    constant u64 INLINE_SIZE = N * sizeof(T);
+    constant u64 INLINE_ALIGNMENT = alignof(T) < mem::DEFAULT_ALIGNMENT ? mem::DEFAULT_ALIGNMENT : alignof(T);
+
+    A * parent_ = null;
+    bool in_use_ = false;
+    alignas(INLINE_ALIGNMENT) byte buffer_[INLINE_SIZE];
+
+    /**
+     * @param block A block of memory
+     * @return Whether `block` is the inline buffer
+     */
+    macro bool is_inline(mem::Block & block) const
+    {
+        return block.data == buffer_;
+    }
+
+public:
+    /**
+     * @return Always null, the allocator belongs to a single vector
+     */
+    static SmallVectorAllocator * instance()
+    {
+        return null;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (not in_use_ and size <= INLINE_SIZE and alignment <= INLINE_ALIGNMENT)
+        {
+            in_use_ = true;
+            return mem::Block { buffer_, size };
+        }
+        return parent_->allocate(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (not in_use_ and size <= INLINE_SIZE and alignment <= INLINE_ALIGNMENT)
+        {
+            return mem::zeroed(allocate(size, alignment));
+        }
+        return parent_->allocate_zeroed(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`, which is the whole inline
+     * buffer for requests which fit in it
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (size <= INLINE_SIZE and alignment <= INLINE_ALIGNMENT)
+        {
+            return INLINE_SIZE;
+        }
+        return parent_->good_size(size, alignment);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which succeeds for the inline
+     * buffer as long as the new size fits in it
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (is_inline(block))
+        {
+            if (size > INLINE_SIZE)
+            {
+                return false;
+            }
+
+            block = mem::Block { block.data, size };
+            return true;
+        }
+        return parent_->reallocate(block, size);
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (is_inline(block))
+        {
+            in_use_ = false;
+            block = mem::Block {};
+            return;
+        }
+        parent_->deallocate(block);
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return is_inline(block) or parent_->owns(block);
+    }
+
+    implicit SmallVectorAllocator & operator=(SmallVectorAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     *
+     * @param parent Pointer to the allocator to spill to
+     */
+    implicit SmallVectorAllocator(A * parent = A::instance()) : parent_(parent)
+    {
+    }
+
+    implicit SmallVectorAllocator(SmallVectorAllocator const & other) = delete;
+};
+
+/**
+ * @brief A dynamic array which holds up to `N` objects inside of itself and only spills
+ * to the allocator `A` once it grows past that
+ *
+ * Moving a small vector relocates the inline objects, while a spilled buffer is handed
+ * over without copying
+ *
+ * @tparam T Type of underlying objects
+ * @tparam N Number of objects which fit in the inline buffer
+ * @tparam A Type of allocator to spill to
+ */
+template <typename T, u64 N, typename A = mem::SystemAllocator>
+struct SmallVector :
+    private std::SmallVectorAllocator<T, N, A>,
+    public std::Vector<T, std::SmallVectorAllocator<T, N, A>>
+{
+private:
+    using Storage = std::SmallVectorAllocator<T, N, A>;
+    using Base = std::Vector<T, Storage>;
+
+    static_assert(N > 0, "Inline buffer must hold at least one object");
+
+    /**
+     * @return Whether the objects currently live in the inline buffer
+     */
+    macro bool is_inline() const
+    {
+        return cast(byte const *, this->data()) == this->buffer_;
+    }
+
+    /**
+     * @brief Makes the empty inline buffer the internal memory block
+     */
+    macro void use_inline()
+    {
+        mem::Block block = Storage::allocate(Storage::INLINE_SIZE);
+        this->set_data(cast(T *, block.data));
+        this->set_size(0);
+        this->set_allocated_size(block.size);
+    }
+
+    /**
+     * @brief Takes over the objects of `other`, leaving it empty and inline
+     *
+     * Expects this vector not to hold a memory block
+     */
+    macro void take(SmallVector & other)
+    {
+        this->parent_ = other.parent_;
+        if (other.is_inline())
+        {
+            use_inline();
+            util::relocate_range(this->data(), other.data(), other.size());
+            this->set_size(other.size());
+        }
+        else
+        {
+            this->set_data(other.data());
+            this->set_size(other.size());
+            this->set_allocated_size(other.allocated_size_);
+
+            other.use_inline();
+        }
+        other.set_size(0);
+    }
+
+public:
+    /**
+     * @return Number of objects which fit in the inline buffer
+     */
+    static constexpr macro u64 inline_capacity()
+    {
+        return N;
+    }
+
+    /**
+     * @brief Clears the array and goes back to the inline buffer
+     */
+    macro void reset()
+    {
+        Base::reset();
+        use_inline();
+    }
+
+    /**
+     * @brief Minimize the difference between `SmallVector::capacity()` and
+     * `SmallVector::size()`, moving the objects back into the inline buffer when they fit
+     */
+    macro void shrink_to_fit()
+    {
+        if (is_inline())
+        {
+            return;
+        }
+
+        if (this->size() <= N)
+        {
+            mem::Block block = Storage::allocate(Storage::INLINE_SIZE);
+            this->move_to(block);
+        }
+        else
+        {
+            Base::shrink_to_fit();
+        }
+    }
+
+    /**
+     * @brief Move assignment operator
+     */
+    macro SmallVector & operator=(SmallVector && other)
+    {
+        if (this != &other)
+        {
+            Base::reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Default constructor
+     *
+     * @param allocator Pointer to the allocator to spill to
+     */
+    implicit macro SmallVector(A * allocator = A::instance()) :
+        Storage(allocator),
+        Base(static_cast<Storage *>(this))
+    {
+        // NOTE:
+        //   Allocators without a global instance return null from `instance()`, so they
+        //   have to be passed in explicitly
+        assert(allocator != null);
+        use_inline();
+    }
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param other Instance to copy from
+     * @param allocator Pointer to the allocator to spill to
+     */
+    implicit macro SmallVector(Span<T> other, A * allocator = A::instance()) :
+        SmallVector(allocator)
+    {
+        this->reserve(other.size());
+        this->set_size(other.size());
+        util::raw_copy_range(this->data(), other.data(), other.size());
+    }
+
+    /**
+     * @brief Move constructor
+     *
+     * @param other Instance to move from
+     */
+    implicit macro SmallVector(SmallVector && other) :
+        Storage(other.parent_),
+        Base(static_cast<Storage *>(this))
+    {
+        take(other);
+    }
+};
+}
\ No newline at end of file
@@ -39,7 +39,7 @@ protected:
      *
      * @param data New pointer to first element
      */
-    macro void set_data(Pointer data)
+    constexpr macro void set_data(Pointer data)
     {
         data_ = data;
     }
@@ -49,7 +49,7 @@ protected:
      *
      * @param data New size
      */
-    macro void set_size(u64 size)
+    constexpr macro void set_size(u64 size)
     {
         size_ = size;
     }
@@ -61,7 +61,7 @@ public:
      * @param data Pointer to the first element in the span
      * @param size Number of elements in this span
      */
-    implicit macro Span(Pointer data, u64 size) : data_(data), size_(size)
+    implicit constexpr macro Span(Pointer data, u64 size) : data_(data), size_(size)
     {
     }
 
@@ -71,14 +71,14 @@ public:
      * @param begin Pointer to the first element in the span
      * @param end Pointer to one past the last element in the span
      */
-    implicit macro Span(Pointer begin, Pointer end) : Span(begin, end - begin)
+    implicit constexpr macro Span(Pointer begin, Pointer end) : Span(begin, end - begin)
     {
     }
 
     /**
      * @return Number of elements in this span
      */
-    macro u64 size() const
+    constexpr macro u64 size() const
     {
         return size_;
     }
@@ -86,7 +86,7 @@ public:
     /**
      * @return Whether this span is empty or not
      */
-    macro bool empty() const
+    constexpr macro bool empty() const
     {
         return size() == 0;
     }
@@ -94,7 +94,7 @@ public:
     /**
      * @return Pointer to the first element in the span
      */
-    macro ConstPointer data() const
+    constexpr macro ConstPointer data() const
     {
         return data_;
     }
@@ -102,7 +102,7 @@ public:
     /**
      * @return Pointer to the first element in the span
      */
-    macro Pointer data()
+    constexpr macro Pointer data()
     {
         return data_;
     }
@@ -110,7 +110,7 @@ public:
     /**
      * @return Pointer to the first element in the span
      */
-    macro ConstPointer begin() const
+    constexpr macro ConstPointer begin() const
     {
         return data_;
     }
@@ -118,7 +118,7 @@ public:
     /**
      * @return Pointer to the first element in the span
      */
-    macro Pointer begin()
+    constexpr macro Pointer begin()
     {
         return data_;
     }
@@ -126,7 +126,7 @@ public:
     /**
      * @return Pointer to one past the last element in the span
      */
-    macro ConstPointer end() const
+    constexpr macro ConstPointer end() const
     {
         return data_ + size_;
     }
@@ -134,7 +134,7 @@ public:
     /**
      * @return Pointer to one past the last element in the span
      */
-    macro Pointer end()
+    constexpr macro Pointer end()
     {
         return data_ + size_;
     }
@@ -143,7 +143,7 @@ public:
      * @param idx
      * @return Item at index idx
      */
-    macro ConstReference at(i64 idx) const
+    constexpr macro ConstReference at(i64 idx) const
     {
         assert(idx >= 0);
         assert(idx < size());
@@ -155,7 +155,7 @@ public:
      * @param idx
      * @return Item at index idx
      */
-    macro Reference at(i64 idx)
+    constexpr macro Reference at(i64 idx)
     {
         assert(idx >= 0);
         assert(idx < size());
@@ -167,7 +167,7 @@ public:
      * @param idx
      * @return Item at index idx
      */
-    macro ConstReference operator[](i64 idx) const
+    constexpr macro ConstReference operator[](i64 idx) const
     {
         assert(idx >= 0);
         assert(idx < size());
@@ -179,7 +179,7 @@ public:
      * @param idx
      * @return Item at index idx
      */
-    macro Reference operator[](i64 idx)
+    constexpr macro Reference operator[](i64 idx)
     {
         assert(idx >= 0);
         assert(idx < size());
@@ -187,12 +187,12 @@ public:
         return at(idx);
     }
 
-    macro Span<T const> copy() const
+    constexpr macro Span<T const> copy() const
     {
-        return *this;
+        return Span<T const>(data_, size_);
     }
 
-    macro Span<T> copy()
+    constexpr macro Span<T> copy()
     {
         return *this;
     }
@@ -202,7 +202,7 @@ public:
      * @param stop
      * @return Sub-span from start to stop
      */
-    macro Span<T const> middle(i64 start, i64 stop) const
+    constexpr macro Span<T const> middle(i64 start, i64 stop) const
     {
         assert(start <= stop);
         assert(start >= 0);
@@ -216,7 +216,7 @@ public:
      * @param stop
      * @return Sub-span from start to stop
      */
-    macro Span<T> middle(i64 start, i64 stop)
+    constexpr macro Span<T> middle(i64 start, i64 stop)
     {
         assert(start <= stop);
         assert(start >= 0);
@@ -229,7 +229,7 @@ public:
      * @param stop
      * @return Sub-span from beginning to stop
      */
-    macro Span<T const> left(i64 stop) const
+    constexpr macro Span<T const> left(i64 stop) const
     {
         assert(stop >= 0);
 
@@ -240,7 +240,7 @@ public:
      * @param stop
      * @return Sub-span from beginning to stop
      */
-    macro Span<T> left(i64 stop)
+    constexpr macro Span<T> left(i64 stop)
     {
         assert(stop >= 0);
 
@@ -251,7 +251,7 @@ public:
      * @param start
      * @return Sub-span from start to the end
      */
-    macro Span<T const> right(i64 start) const
+    constexpr macro Span<T const> right(i64 start) const
     {
         assert(start >= 0);
 
@@ -262,30 +262,30 @@ public:
      * @param start
      * @return Sub-span from start to the end
      */
-    macro Span<T> right(i64 start)
+    constexpr macro Span<T> right(i64 start)
     {
         assert(start >= 0);
 
         return middle(start, size_);
     }
 
-    macro Span<T> const & me() const
+    constexpr macro Span<T> const & me() const
     {
         return *this;
     }
 
-    macro Span<T> & me()
+    constexpr macro Span<T> & me()
     {
         return *this;
     }
 
-    implicit macro operator Span<T const>() const
+    implicit constexpr macro operator Span<T const>() const
     {
         return copy();
     }
 
     template <typename F>
-    macro void operator<<(iterate::visitor<F, iterate::forward> f) const
+    constexpr macro void operator<<(iterate::visitor<F, iterate::forward> f) const
     {
         T * b = data();
         T * e = data() + size();
@@ -296,7 +296,7 @@ public:
     }
 
     template <typename F>
-    macro void operator<<(iterate::visitor<F, iterate::forward> f)
+    constexpr macro void operator<<(iterate::visitor<F, iterate::forward> f)
     {
         T * b = data();
         T * e = data() + size();
@@ -307,7 +307,7 @@ public:
     }
 
     template <typename F>
-    macro void operator<<(iterate::visitor<F, iterate::backward> f) const
+    constexpr macro void operator<<(iterate::visitor<F, iterate::backward> f) const
     {
         T * b = data();
         T * e = data() + size();
@@ -318,7 +318,7 @@ public:
     }
 
     template <typename F>
-    macro void operator<<(iterate::visitor<F, iterate::backward> f)
+    constexpr macro void operator<<(iterate::visitor<F, iterate::backward> f)
     {
         T * b = data();
         T * e = data() + size();
@@ -331,31 +331,31 @@ public:
     /**
      * @brief Default copy assignment operator
      */
-    macro Span<T> & operator=(Span const & other) = default;
+    constexpr macro Span<T> & operator=(Span const & other) = default;
 
     /**
      * @brief Default move assignment operator
      */
-    macro Span<T> & operator=(Span && other) = default;
+    constexpr macro Span<T> & operator=(Span && other) = default;
 
     /**
      * @brief Default constructor
      */
-    implicit macro Span() = default;
+    implicit constexpr macro Span() = default;
 
     /**
      * @brief Default copy constructor
      */
-    implicit macro Span(Span const & other) = default;
+    implicit constexpr macro Span(Span const & other) = default;
 
     /**
      * @brief Default move constructor
      */
-    implicit macro Span(Span && other) = default;
+    implicit constexpr macro Span(Span && other) = default;
 
     /**
      * @brief Default destructor
      */
-    implicit macro ~Span() = default;
+    implicit constexpr macro ~Span() = default;
 };
 }
\ No newline at end of file
@@ -0,0 +1,167 @@
+/**
+ * @file StackAllocator.hpp
+ * @brief Allocator which carves blocks out of a buffer inside of itself
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Hands out blocks from an inline buffer in LIFO order
+ *
+ * Only the top block can be reallocated inplace or reclaimed by `deallocate`, so the
+ * allocator works best when it is the primary of a `mem::FallbackAllocator` and
+ * lives next to the container using it. Such a composite has to be declared next to
+ * the container and passed to it explicitly, since the global instance of the
+ * composite would share a single buffer across the whole process
+ *
+ * @tparam N Size of the inline buffer in bytes
+ */
+template <u64 N>
+struct StackAllocator
+{
+private:
+    constant u64 ALIGNMENT = 16;
+
+    alignas(ALIGNMENT) byte buffer_[N];
+    u64 top_ = 0;
+
+    /**
+     * @param block A block of memory
+     * @return Offset of the block from the start of the buffer
+     */
+    u64 offset_of(mem::Block & block) const
+    {
+        return cast(byte *, block.data) - buffer_;
+    }
+
+    /**
+     * @param block A block of memory owned by this allocator
+     * @return Whether `block` is the most recent block
+     */
+    bool is_top(mem::Block & block) const
+    {
+        return offset_of(block) + block.size == top_;
+    }
+
+public:
+    /**
+     * @return Always null, the buffer belongs next to the container which uses it, so
+     * there is no global instance
+     */
+    static StackAllocator * instance()
+    {
+        return null;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        u64 start = cast(u64, buffer_);
+        u64 offset = mem::align_up(start + top_, alignment < ALIGNMENT ? ALIGNMENT : alignment) - start;
+        if (offset > N or N - offset < size)
+        {
+            return mem::Block {};
+        }
+
+        top_ = offset + size;
+        return mem::Block { buffer_ + offset, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @return Usable size of a block allocated with `size`, which does not depend on the
+     * alignment since padding is skipped in front of the block
+     */
+    u64 good_size(u64 size, u64 = mem::DEFAULT_ALIGNMENT)
+    {
+        return mem::align_up(size, ALIGNMENT);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which only succeeds for the
+     * top block or when shrinking
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not owns(block))
+        {
+            return false;
+        }
+
+        if (is_top(block))
+        {
+            if (N - offset_of(block) < size)
+            {
+                return false;
+            }
+            top_ = offset_of(block) + size;
+        }
+        else if (size > block.size)
+        {
+            return false;
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Invalidates a block of memory, which is only reclaimed if it is the top
+     * block
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (owns(block) and is_top(block))
+        {
+            top_ = offset_of(block);
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        byte * data = cast(byte *, block.data);
+        return data >= buffer_ and data < buffer_ + N;
+    }
+
+    implicit StackAllocator & operator=(StackAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     */
+    implicit StackAllocator()
+    {
+    }
+
+    implicit StackAllocator(StackAllocator const & other) = delete;
+};
+}
\ No newline at end of file
@@ -0,0 +1,267 @@
+/**
+ * @file StaticVector.hpp
+ * @brief A fixed capacity array of objects stored inside of itself
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace std
+{
+/**
+ * @brief A dynamic array of up to `N` objects which never allocates
+ *
+ * The objects live in an inline array, so there is neither an allocator nor a memory
+ * block to keep track of. Growing past `N` objects is a programming error
+ *
+ * Trivial objects are created by assignment rather than placement new, which makes the
+ * whole container usable in `constexpr`
+ *
+ * @tparam T Type of underlying objects
+ * @tparam N Largest number of objects the array can hold
+ */
+template <typename T, u64 N>
+struct StaticVector : Span<T>
+{
+private:
+    using Base = Span<T>;
+
+    static_assert(N > 0, "Static vector must hold at least one object");
+
+    constant bool TRIVIAL = __is_trivially_copyable(T) and __is_trivially_constructible(T);
+
+    // NOTE:
+    //   The union keeps the objects past `StaticVector::size()` uninitialized
+    union
+    {
+        T items_[N];
+    };
+
+    /**
+     * @brief Creates an object at index `idx`, which must not hold an object yet
+     *
+     * @param args Arguments, forwarded to the new object's constructor
+     */
+    template <typename... Ts>
+    constexpr macro void construct(u64 idx, Ts &&... args)
+    {
+        if constexpr (TRIVIAL)
+        {
+            items_[idx] = T(std::forward<Ts>(args)...);
+        }
+        else
+        {
+            new (&items_[idx]) T(std::forward<Ts>(args)...);
+        }
+    }
+
+    /**
+     * @brief Destroys the objects from index `start` onwards and sets the size to `start`
+     */
+    constexpr macro void truncate(u64 start)
+    {
+        if constexpr (not TRIVIAL)
+        {
+            for (u64 idx = start; idx < this->size(); ++idx)
+            {
+                items_[idx].~T();
+            }
+        }
+        this->set_size(start);
+    }
+
+    /**
+     * @brief Copies every object of `other` into this empty vector
+     */
+    constexpr macro void copy_from(Span<T const> other)
+    {
+        assert(other.size() <= N);
+
+        for (u64 idx = 0; idx < other.size(); ++idx)
+        {
+            construct(idx, other[idx]);
+        }
+        this->set_size(other.size());
+    }
+
+    /**
+     * @brief Moves every object of `other` into this empty vector
+     */
+    constexpr macro void move_from(StaticVector & other)
+    {
+        for (u64 idx = 0; idx < other.size(); ++idx)
+        {
+            construct(idx, std::reuse(other.items_[idx]));
+        }
+        this->set_size(other.size());
+    }
+
+public:
+    /**
+     * @return Number of elements this vector can hold
+     */
+    static constexpr macro u64 capacity()
+    {
+        return N;
+    }
+
+    /**
+     * @return Whether the vector has no room for another object
+     */
+    constexpr macro bool full() const
+    {
+        return this->size() == N;
+    }
+
+    /**
+     * @brief Sets the `StaticVector::size()` of this vector and (de)initializes items as
+     * needed
+     *
+     * @param new_size New number of elements in this vector, at most `N`
+     * @param value Initial value for new elements when `new_size > StaticVector::size`
+     */
+    constexpr macro void resize(u64 new_size, T const & value = T {})
+    {
+        assert(new_size <= N);
+
+        u64 old_size = this->size();
+        if (new_size <= old_size)
+        {
+            truncate(new_size);
+            return;
+        }
+
+        for (u64 idx = old_size; idx < new_size; ++idx)
+        {
+            construct(idx, value);
+        }
+        this->set_size(new_size);
+    }
+
+    /**
+     * @brief Inserts an object at the end of the array
+     *
+     * @param item Object to insert
+     */
+    constexpr macro void push_back(T item)
+    {
+        emplace_back(std::reuse(item));
+    }
+
+    /**
+     * @brief Creates an object at the end of the array
+     *
+     * @param args Arguments, forwarded to the new object's constructor
+     */
+    template <typename... Ts>
+    constexpr macro void emplace_back(Ts &&... args)
+    {
+        assert(not full());
+
+        u64 old_size = this->size();
+        construct(old_size, std::forward<Ts>(args)...);
+        this->set_size(old_size + 1);
+    }
+
+    /**
+     * @brief Removes all elements from the array
+     */
+    constexpr macro void clear()
+    {
+        truncate(0);
+    }
+
+    /**
+     * @brief Copy assignment operator
+     */
+    constexpr macro StaticVector & operator=(StaticVector const & other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator
+     */
+    constexpr macro StaticVector & operator=(StaticVector && other)
+    {
+        if (this != &other)
+        {
+            clear();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Default constructor
+     */
+    implicit constexpr macro StaticVector()
+    {
+        this->set_data(items_);
+    }
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param other Instance to copy from
+     */
+    implicit constexpr macro StaticVector(Span<T const> other)
+    {
+        this->set_data(items_);
+        copy_from(other);
+    }
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param other Instance to copy from
+     */
+    implicit constexpr macro StaticVector(StaticVector const & other) : Base()
+    {
+        this->set_data(items_);
+        copy_from(other);
+    }
+
+    /**
+     * @brief Move constructor, which moves the objects one by one
+     *
+     * @param other Instance to move from
+     */
+    implicit constexpr macro StaticVector(StaticVector && other)
+    {
+        this->set_data(items_);
+        move_from(other);
+    }
+
+    /**
+     * @brief Destructor
+     */
+    implicit constexpr macro ~StaticVector()
+    {
+        clear();
+    }
+};
+
+// NOTE:
+//   Keeps the `constexpr` promise for trivial objects honest
+static_assert(
+    [] {
+        StaticVector<u64, 4> vector;
+        vector.push_back(1);
+        vector.emplace_back(2);
+        vector.resize(4, 3);
+        vector.resize(3);
+
+        StaticVector<u64, 4> copy = vector;
+        return copy.size() == 3 and copy[0] == 1 and copy[1] == 2 and copy[2] == 3;
+    }(),
+    "Static vectors of trivial objects must be usable in constexpr"
+);
+}
\ No newline at end of file
@@ -0,0 +1,233 @@
+/**
+ * @file StatsAllocator.hpp
+ * @brief Allocator decorator which collects usage statistics
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// NOTE:
+//   Define as 0 to turn every `mem::StatsAllocator` into a plain forwarding wrapper
+#ifndef CONFIG_ALLOCATOR_STATS
+    #define CONFIG_ALLOCATOR_STATS 1
+#endif
+
+namespace mem
+{
+/**
+ * @brief Snapshot of the statistics collected by a `mem::StatsAllocator`
+ */
+struct AllocationStats
+{
+    u64 allocations = 0;
+    u64 failed_allocations = 0;
+    u64 reallocations = 0;
+    u64 failed_reallocations = 0;
+    u64 deallocations = 0;
+
+    u64 live_bytes = 0;
+    u64 peak_bytes = 0;
+
+    // NOTE:
+    //   Bucket `i` counts sizes with a bit width of `i`, so bucket 0 only holds empty
+    //   requests and bucket `i > 0` holds sizes in `[2^(i - 1), 2^i)`
+    u64 allocation_sizes[65] = {};
+    u64 failed_reallocation_sizes[65] = {};
+
+    /**
+     * @param size A size in bytes
+     * @return Histogram bucket of `size`
+     */
+    static macro u64 bucket_of(u64 size)
+    {
+        return size == 0 ? 0 : 64 - __builtin_clzll(size);
+    }
+};
+
+/**
+ * @brief Forwards every call to `A` and records what happened
+ *
+ * Compiles down to `A` alone when `CONFIG_ALLOCATOR_STATS` is 0, in which case
+ * `StatsAllocator::stats()` always returns an empty snapshot
+ *
+ * @tparam A Type of allocator to collect statistics for
+ */
+template <typename A>
+struct StatsAllocator : private A
+{
+private:
+#if CONFIG_ALLOCATOR_STATS
+    mem::AllocationStats stats_;
+#endif
+
+    /**
+     * @brief Adjusts the live byte count by `delta` bytes and updates the peak
+     */
+    macro void track_live_bytes(i64 delta)
+    {
+#if CONFIG_ALLOCATOR_STATS
+        stats_.live_bytes += delta;
+        if (stats_.live_bytes > stats_.peak_bytes)
+        {
+            stats_.peak_bytes = stats_.live_bytes;
+        }
+#endif
+    }
+
+    /**
+     * @brief Records an allocation request of `size` bytes which produced `block`
+     */
+    macro void track_allocation(u64 size, mem::Block & block)
+    {
+#if CONFIG_ALLOCATOR_STATS
+        stats_.allocation_sizes[mem::AllocationStats::bucket_of(size)]++;
+        if (block)
+        {
+            stats_.allocations++;
+            track_live_bytes(block.size);
+        }
+        else
+        {
+            stats_.failed_allocations++;
+        }
+#endif
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator, or null when the wrapped
+     * allocator has no global instance either
+     */
+    static StatsAllocator * instance()
+    {
+        if (A::instance() == null)
+        {
+            return null;
+        }
+
+        static StatsAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @return A snapshot of the statistics collected so far
+     */
+    mem::AllocationStats stats() const
+    {
+#if CONFIG_ALLOCATOR_STATS
+        return stats_;
+#else
+        return mem::AllocationStats {};
+#endif
+    }
+
+    /**
+     * @brief Clears every counter except for the live byte count
+     */
+    void reset_stats()
+    {
+#if CONFIG_ALLOCATOR_STATS
+        u64 live_bytes = stats_.live_bytes;
+        stats_ = mem::AllocationStats {};
+        stats_.live_bytes = live_bytes;
+        stats_.peak_bytes = live_bytes;
+#endif
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        mem::Block block = A::allocate(size, alignment);
+        track_allocation(size, block);
+        return block;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        mem::Block block = A::allocate_zeroed(size, alignment);
+        track_allocation(size, block);
+        return block;
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return A::good_size(size, alignment);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        // NOTE:
+        //   Containers try to grow their empty block in place before allocating one, which
+        //   is not a reallocation that failed
+        if (not block)
+        {
+            return A::reallocate(block, size);
+        }
+
+        u64 old_size = block.size;
+        bool success = A::reallocate(block, size);
+#if CONFIG_ALLOCATOR_STATS
+        if (success)
+        {
+            stats_.reallocations++;
+            track_live_bytes(cast(i64, block.size) - cast(i64, old_size));
+        }
+        else
+        {
+            stats_.failed_reallocations++;
+            stats_.failed_reallocation_sizes[mem::AllocationStats::bucket_of(size)]++;
+        }
+#endif
+        return success;
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+#if CONFIG_ALLOCATOR_STATS
+        if (block)
+        {
+            stats_.deallocations++;
+            track_live_bytes(-cast(i64, block.size));
+        }
+#endif
+        A::deallocate(block);
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return A::owns(block);
+    }
+};
+}
\ No newline at end of file
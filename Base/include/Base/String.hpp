@@ -0,0 +1,561 @@
+/**
+ * @file String.hpp
+ * @brief A null terminated string which keeps short text inside of itself
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace std
+{
+/**
+ * @brief A dynamic, null terminated array of characters which holds up to 23 characters
+ * inside of itself and only spills to the allocator `A` once it grows past that
+ *
+ * The inline characters share their 24 bytes with the pointer, size and capacity of a
+ * spilled string, so the whole string is as large as those and the allocator pointer.
+ * Every member keeps the null terminator in place, and the string converts to a
+ * `std::Span<c8 const>` view of its characters
+ *
+ * @tparam A Type of allocator to spill to
+ * @tparam G Growth policy used when an insertion runs out of capacity
+ */
+template <typename A = mem::SystemAllocator, typename G = std::DefaultGrowth>
+struct String
+{
+private:
+    static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Layout relies on little endian");
+
+    constant u64 INLINE_CAPACITY = 23;
+    constant u64 HEAP_FLAG = cast(u64, 1) << 63;
+
+    struct Heap
+    {
+        c8 * data;
+        u64 size;
+        u64 capacity;
+    };
+
+    // NOTE:
+    //   The last inline byte overlaps the top byte of `Heap::capacity`. Inline strings keep
+    //   the number of unused inline characters there, which makes it the null terminator
+    //   of a full buffer, and spilled strings set its top bit
+    union
+    {
+        Heap heap_;
+        c8 inline_[INLINE_CAPACITY + 1];
+    };
+    A * allocator_ = null;
+
+    /**
+     * @return Whether the characters currently live in the inline buffer
+     */
+    macro bool is_inline() const
+    {
+        return (cast(u8, inline_[INLINE_CAPACITY]) & 0x80) == 0;
+    }
+
+    /**
+     * @brief Sets the `String::size()` of this string and writes the null terminator after
+     * the last character
+     */
+    macro void set_size(u64 new_size)
+    {
+        if (is_inline())
+        {
+            inline_[INLINE_CAPACITY] = cast(c8, INLINE_CAPACITY - new_size);
+        }
+        else
+        {
+            heap_.size = new_size;
+        }
+        data()[new_size] = 0;
+    }
+
+    /**
+     * @return The memory block of a spilled string, including the null terminator
+     */
+    macro mem::Block heap_block() const
+    {
+        return mem::Block { heap_.data, (heap_.capacity & ~HEAP_FLAG) + 1 };
+    }
+
+    /**
+     * @brief Makes the empty inline buffer hold the characters
+     */
+    macro void use_inline()
+    {
+        inline_[0] = 0;
+        inline_[INLINE_CAPACITY] = INLINE_CAPACITY;
+    }
+
+    /**
+     * @brief Deallocates the memory block of a spilled string
+     */
+    macro void deallocate()
+    {
+        if (not is_inline())
+        {
+            mem::Block block = heap_block();
+            allocator().deallocate(block);
+        }
+    }
+
+    /**
+     * @brief Moves the characters into a memory block which holds at least
+     * `new_capacity` characters, unless the current block can be reallocated inplace
+     *
+     * @param new_capacity Number of characters that this string should be able to hold
+     */
+    void grow(u64 new_capacity)
+    {
+        u64 block_size = allocator().good_size(new_capacity + 1);
+        if (not is_inline())
+        {
+            mem::Block block = heap_block();
+            if (allocator().reallocate(block, block_size))
+            {
+                heap_.capacity = (block.size - 1) | HEAP_FLAG;
+                return;
+            }
+        }
+
+        mem::Block block = allocator().allocate(block_size);
+        assert(block);
+
+        u64 old_size = size();
+        mem::copy(block.data, data(), old_size + 1);
+        deallocate();
+        heap_ = Heap { cast(c8 *, block.data), old_size, (block.size - 1) | HEAP_FLAG };
+    }
+
+    /**
+     * @brief Sets the `String::size()` of this string, growing it geometrically, without
+     * initializing new characters
+     */
+    macro void unsafe_resize(u64 new_size)
+    {
+        if (new_size > capacity())
+        {
+            grow(G::grow(capacity(), new_size));
+        }
+        set_size(new_size);
+    }
+
+    /**
+     * @brief Takes over the characters of `other`, leaving it empty and inline
+     *
+     * Expects this string not to hold a memory block
+     */
+    macro void take(String & other)
+    {
+        allocator_ = other.allocator_;
+        mem::copy(inline_, other.inline_, sizeof(inline_));
+        other.use_inline();
+    }
+
+    /**
+     * @param text A null terminated string
+     * @return Number of characters in front of the null terminator
+     */
+    static macro u64 length_of(c8 const * text)
+    {
+        u64 length = 0;
+        while (text[length] != 0)
+        {
+            length++;
+        }
+        return length;
+    }
+
+public:
+    /**
+     * @return This instance's allocator
+     */
+    macro A const & allocator() const
+    {
+        return *allocator_;
+    }
+
+    /**
+     * @return This instance's allocator
+     */
+    macro A & allocator()
+    {
+        return *allocator_;
+    }
+
+    /**
+     * @return Pointer to the first character
+     */
+    macro c8 const * data() const
+    {
+        return is_inline() ? inline_ : heap_.data;
+    }
+
+    /**
+     * @return Pointer to the first character
+     */
+    macro c8 * data()
+    {
+        return is_inline() ? inline_ : heap_.data;
+    }
+
+    /**
+     * @return Number of characters in the string, without the null terminator
+     */
+    macro u64 size() const
+    {
+        return is_inline() ? INLINE_CAPACITY - cast(u8, inline_[INLINE_CAPACITY]) : heap_.size;
+    }
+
+    /**
+     * @return Whether the string holds no characters
+     */
+    macro bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @return Number of characters this string can hold before reallocating
+     */
+    macro u64 capacity() const
+    {
+        return is_inline() ? INLINE_CAPACITY : heap_.capacity & ~HEAP_FLAG;
+    }
+
+    /**
+     * @return Pointer to the null terminated characters of the string
+     */
+    macro c8 const * c_str() const
+    {
+        return data();
+    }
+
+    /**
+     * @return A view of the characters of the string, without the null terminator
+     */
+    macro Span<c8 const> view() const
+    {
+        return Span<c8 const>(data(), size());
+    }
+
+    implicit macro operator Span<c8 const>() const
+    {
+        return view();
+    }
+
+    /**
+     * @param idx Index of a character, less than `String::size()`
+     * @return The character at index `idx`
+     */
+    macro c8 const & operator[](u64 idx) const
+    {
+        assert(idx < size());
+        return data()[idx];
+    }
+
+    /**
+     * @param idx Index of a character, less than `String::size()`
+     * @return The character at index `idx`
+     */
+    macro c8 & operator[](u64 idx)
+    {
+        assert(idx < size());
+        return data()[idx];
+    }
+
+    macro String const & me() const
+    {
+        return *this;
+    }
+
+    macro String & me()
+    {
+        return *this;
+    }
+
+    template <typename F, typename D>
+    macro void operator<<(iterate::visitor<F, D> f) const
+    {
+        view() << f;
+    }
+
+    template <typename F, typename D>
+    macro void operator<<(iterate::visitor<F, D> f)
+    {
+        Span<c8>(data(), size()) << f;
+    }
+
+    /**
+     * @brief Make sure the string has enough space for `new_capacity` characters without
+     * needing to (re)allocate the internal memory block
+     *
+     * @param new_capacity Number of characters that this string should be able to hold
+     */
+    macro void reserve(u64 new_capacity)
+    {
+        if (new_capacity > capacity())
+        {
+            grow(new_capacity);
+        }
+    }
+
+    /**
+     * @brief Sets the `String::size()` of this string
+     *
+     * @param new_size New number of characters in this string
+     * @param value Character to fill new space with when `new_size > String::size()`
+     */
+    macro void resize(u64 new_size, c8 value = 0)
+    {
+        u64 old_size = size();
+        unsafe_resize(new_size);
+        for (u64 idx = old_size; idx < new_size; ++idx)
+        {
+            data()[idx] = value;
+        }
+    }
+
+    /**
+     * @brief Appends a character to the end of the string
+     *
+     * @param character Character to append
+     */
+    macro void push_back(c8 character)
+    {
+        u64 old_size = size();
+        unsafe_resize(old_size + 1);
+        data()[old_size] = character;
+    }
+
+    /**
+     * @brief Appends characters to the end of the string, growing it geometrically
+     *
+     * @param text Characters to append, must not point into this string
+     */
+    macro void append(Span<c8 const> text)
+    {
+        u64 old_size = size();
+        unsafe_resize(old_size + text.size());
+        mem::copy(data() + old_size, text.data(), text.size());
+    }
+
+    /**
+     * @brief Appends a null terminated string to the end of the string
+     *
+     * @param text A null terminated string, must not point into this string
+     */
+    macro void append(c8 const * text)
+    {
+        append(Span<c8 const>(text, length_of(text)));
+    }
+
+    /**
+     * @brief Copies characters into the string in front of the character at index `idx`
+     *
+     * @param idx Index at which the first new character ends up
+     * @param text Characters to insert, must not point into this string
+     */
+    macro void insert(u64 idx, Span<c8 const> text)
+    {
+        assert(idx <= size());
+
+        u64 old_size = size();
+        unsafe_resize(old_size + text.size());
+
+        c8 * tail = data() + idx;
+        mem::move(tail + text.size(), tail, old_size - idx);
+        mem::copy(tail, text.data(), text.size());
+    }
+
+    /**
+     * @brief Removes the characters from index `start` up to index `stop`
+     *
+     * @param start Index of the first character to remove
+     * @param stop Index one past the last character to remove
+     */
+    macro void erase(u64 start, u64 stop)
+    {
+        assert(start <= stop);
+        assert(stop <= size());
+
+        u64 old_size = size();
+        mem::move(data() + start, data() + stop, old_size - stop);
+        set_size(old_size - (stop - start));
+    }
+
+    /**
+     * @brief Removes all characters from the string
+     */
+    macro void clear()
+    {
+        set_size(0);
+    }
+
+    /**
+     * @brief Clears the string and goes back to the inline buffer
+     */
+    macro void reset()
+    {
+        deallocate();
+        use_inline();
+    }
+
+    /**
+     * @brief Minimize the difference between `String::capacity()` and `String::size()`,
+     * moving short text back into the inline buffer
+     */
+    macro void shrink_to_fit()
+    {
+        if (is_inline())
+        {
+            return;
+        }
+
+        mem::Block block = heap_block();
+        u64 old_size = heap_.size;
+        if (old_size <= INLINE_CAPACITY)
+        {
+            mem::copy(inline_, block.data, old_size + 1);
+            inline_[INLINE_CAPACITY] = cast(c8, INLINE_CAPACITY - old_size);
+            allocator().deallocate(block);
+        }
+        else if (allocator().reallocate(block, allocator().good_size(old_size + 1)))
+        {
+            heap_.capacity = (block.size - 1) | HEAP_FLAG;
+        }
+    }
+
+    /**
+     * @param text Characters to compare with
+     * @return Whether the string holds exactly the characters of `text`
+     */
+    macro bool operator==(Span<c8 const> text) const
+    {
+        if (size() != text.size())
+        {
+            return false;
+        }
+
+        c8 const * characters = data();
+        for (u64 idx = 0; idx < text.size(); ++idx)
+        {
+            if (characters[idx] != text[idx])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @param text A null terminated string
+     * @return Whether the string holds exactly the characters of `text`
+     */
+    macro bool operator==(c8 const * text) const
+    {
+        return *this == Span<c8 const>(text, length_of(text));
+    }
+
+    /**
+     * @brief Copy assignment operator
+     */
+    macro String & operator=(String const & other)
+    {
+        if (this != &other)
+        {
+            clear();
+            append(other.view());
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator
+     */
+    macro String & operator=(String && other)
+    {
+        if (this != &other)
+        {
+            deallocate();
+            take(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Default constructor
+     *
+     * @param allocator Pointer to the allocator to spill to
+     */
+    implicit macro String(A * allocator = A::instance()) : allocator_(allocator)
+    {
+        // NOTE:
+        //   Allocators without a global instance return null from `instance()`, so they
+        //   have to be passed in explicitly
+        assert(allocator != null);
+        use_inline();
+    }
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param text Characters to copy
+     * @param allocator Pointer to the allocator to spill to
+     */
+    implicit macro String(Span<c8 const> text, A * allocator = A::instance()) :
+        String(allocator)
+    {
+        append(text);
+    }
+
+    /**
+     * @brief Constructs a string from a null terminated string
+     *
+     * @param text A null terminated string
+     * @param allocator Pointer to the allocator to spill to
+     */
+    implicit macro String(c8 const * text, A * allocator = A::instance()) :
+        String(Span<c8 const>(text, length_of(text)), allocator)
+    {
+    }
+
+    /**
+     * @brief Copy constructor, which spills to the allocator of `other`
+     *
+     * @param other Instance to copy from
+     */
+    implicit macro String(String const & other) : String(other.view(), other.allocator_)
+    {
+    }
+
+    /**
+     * @brief Move constructor
+     *
+     * @param other Instance to move from
+     */
+    implicit macro String(String && other)
+    {
+        take(other);
+    }
+
+    /**
+     * @brief Destructor
+     */
+    implicit macro ~String()
+    {
+        deallocate();
+    }
+};
+
+static_assert(sizeof(String<>) == 32, "Strings must stay as large as three words and a pointer");
+
+// NOTE:
+//   Neither the inline characters nor the spilled block point back at the string
+template <typename A, typename G>
+constant auto is_trivially_relocatable<std::String<A, G>> = true;
+}
\ No newline at end of file
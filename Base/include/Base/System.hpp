@@ -35,12 +35,31 @@ void * module_handle();
  * @brief Allocates a block of memory via OS allocation functions
  *
  * @param size Requested size of the block
+ * @param alignment Requested alignment of the block, a power of two
  * @return A pointer to a newly allocated block of memory or null
  */
-void * allocate(i64 size);
+void * allocate(i64 size, i64 alignment = 16);
 
 /**
- * @brief Rellocates a block of memory inplace
+ * @brief Allocates a block of memory which is filled with zeroes, which is free for
+ * blocks backed by fresh pages from the OS
+ *
+ * @param size Requested size of the block
+ * @param alignment Requested alignment of the block, a power of two
+ * @return A pointer to a newly allocated block of memory or null
+ */
+void * allocate_zeroed(i64 size, i64 alignment = 16);
+
+/**
+ * @param size Requested size of a block
+ * @param alignment Requested alignment of a block, a power of two
+ * @return Number of usable bytes in a block allocated by `sys::allocate` with this size
+ * and alignment, which may be larger than `size` due to size classes or page granularity
+ */
+i64 good_size(i64 size, i64 alignment = 16);
+
+/**
+ * @brief Rellocates a block of memory inplace, which preserves its alignment
  *
  * @param data Block of memory that should reallocate
  * @param size Requested size of the block
@@ -54,4 +73,104 @@ bool reallocate(void * data, i64 size);
  * @param data Memory to be deallocated
  */
 void deallocate(void * data);
+
+/**
+ * @brief Allocates `count` blocks of `size` bytes at once, which may be cheaper than
+ * allocating them one by one
+ *
+ * @param count Number of blocks to allocate
+ * @param size Requested size of every block
+ * @param out Array which receives `count` pointers
+ * @param alignment Requested alignment of every block, a power of two
+ * @return Number of blocks allocated before running out of memory
+ */
+i64 allocate_batch(i64 count, i64 size, void ** out, i64 alignment = 16);
+
+/**
+ * @brief Deallocates `count` blocks of memory at once
+ *
+ * @param data Array of pointers to memory to be deallocated
+ * @param count Number of pointers in `data`
+ */
+void deallocate_batch(void ** data, i64 count);
+
+/**
+ * @return Granularity of `sys::commit` and `sys::decommit`
+ */
+i64 page_size();
+
+/**
+ * @brief Reserves a range of address space without backing it with memory
+ *
+ * @param size Requested size of the range
+ * @return A pointer to the start of the range or null
+ */
+void * reserve(i64 size);
+
+/**
+ * @brief Backs pages inside of a reserved range with readable and writable memory
+ *
+ * @param data Page aligned start of the pages
+ * @param size Size of the pages, multiple of `sys::page_size()`
+ * @return Whether the pages were committed
+ */
+bool commit(void * data, i64 size);
+
+/**
+ * @brief Returns the memory behind committed pages to the OS, but keeps their range
+ * reserved
+ *
+ * @param data Page aligned start of the pages
+ * @param size Size of the pages, multiple of `sys::page_size()`
+ */
+void decommit(void * data, i64 size);
+
+/**
+ * @brief Releases a range reserved by `sys::reserve`
+ *
+ * @param data Start of the range
+ * @param size Size of the range, as passed to `sys::reserve`
+ */
+void unreserve(void * data, i64 size);
+
+/**
+ * @return Size and alignment of a huge page
+ */
+i64 huge_page_size();
+
+/**
+ * @brief Allocates committed memory aligned to, and preferably backed by, huge pages
+ *
+ * Falls back to regular pages if the OS does not hand out huge pages
+ *
+ * @param size Requested size of the block, multiple of `sys::huge_page_size()`
+ * @return A pointer to a newly allocated block of memory or null
+ */
+void * allocate_huge_pages(i64 size);
+
+/**
+ * @brief Deallocates memory allocated by `sys::allocate_huge_pages`
+ *
+ * @param data Memory to be deallocated
+ * @param size Size of the block, as passed to `sys::allocate_huge_pages`
+ */
+void deallocate_huge_pages(void * data, i64 size);
+
+/**
+ * @return Current value of the CPU cycle counter, or of the virtual timer on AArch64,
+ * cheap enough to timestamp individual allocations
+ */
+macro u64 timestamp()
+{
+#if defined(__aarch64__)
+    // NOTE:
+    //   The cycle counter of AArch64 traps in user mode unless the kernel enables it, while
+    //   the virtual timer is always readable
+    u64 ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return __builtin_readcyclecounter();
+#endif
+}
 }
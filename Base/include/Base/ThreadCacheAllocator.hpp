@@ -0,0 +1,320 @@
+/**
+ * @file ThreadCacheAllocator.hpp
+ * @brief Per-thread cache of freed blocks in front of a shared allocator
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Keeps freed blocks of up to `Max` bytes in power of two size classes, so most
+ * allocations of the owning thread never reach the shared parent allocator
+ *
+ * Every thread is meant to own its own cache and to hand it to its containers, the
+ * parent is shared and has to be thread-safe. Empty classes are refilled from the
+ * parent in batches, and once more than `Budget` bytes are cached, half of the class
+ * that went over is returned to the parent
+ *
+ * @tparam A Type of the shared parent allocator
+ * @tparam Budget Largest number of bytes kept in the cache
+ * @tparam Max Largest request size served from the cache, a power of two
+ */
+template <typename A = mem::SystemAllocator, u64 Budget = 256 * 1024, u64 Max = 32 * 1024>
+struct ThreadCacheAllocator
+{
+private:
+    struct Node
+    {
+        Node * next;
+    };
+
+    struct Stash
+    {
+        Node * free;
+        u64 count;
+    };
+
+    constant u64 SMALLEST_CLASS_SHIFT = 4;
+
+    // NOTE:
+    //   Largest number of blocks moved between the cache and the parent at once
+    constant u64 BATCH_SIZE = 32;
+
+    static_assert(Max >= 16 and (Max & (Max - 1)) == 0, "Max must be a power of two");
+    static_assert(Budget >= Max, "Budget must fit at least one block of every class");
+
+    constant u64 CLASS_COUNT = 64 - __builtin_clzll(Max) - SMALLEST_CLASS_SHIFT;
+
+    A * parent_ = null;
+    Stash stashes_[CLASS_COUNT] = {};
+    u64 cached_bytes_ = 0;
+
+    /**
+     * @param size Size of a block, at most `Max`
+     * @return Index of the smallest size class that can hold the block
+     */
+    static macro u64 class_of(u64 size)
+    {
+        if (size <= (1 << SMALLEST_CLASS_SHIFT))
+        {
+            return 0;
+        }
+        return 64 - __builtin_clzll(size - 1) - SMALLEST_CLASS_SHIFT;
+    }
+
+    /**
+     * @param index Index of a size class
+     * @return Size of every block in the size class
+     */
+    static macro u64 class_size(u64 index)
+    {
+        return cast(u64, 1) << (index + SMALLEST_CLASS_SHIFT);
+    }
+
+    /**
+     * @param size Size of a block
+     * @return Whether blocks of this size go through the cache
+     */
+    static macro bool is_cached(u64 size)
+    {
+        return size > 0 and size <= Max;
+    }
+
+    /**
+     * @brief Allocates a batch of blocks for an empty size class from the parent
+     */
+    void refill(u64 index)
+    {
+        // NOTE:
+        //   Larger classes get smaller batches, so a single refill never takes up more
+        //   than a quarter of the budget
+        u64 size = class_size(index);
+        u64 count = Budget / 4 / size;
+        count = count < 1 ? 1 : count > BATCH_SIZE ? BATCH_SIZE : count;
+
+        mem::Block blocks[BATCH_SIZE];
+        u64 allocated = mem::allocate_batch(*parent_, count, size, blocks);
+
+        Stash & stash = stashes_[index];
+        for (u64 idx = 0; idx < allocated; ++idx)
+        {
+            Node * node = cast(Node *, blocks[idx].data);
+            node->next = stash.free;
+            stash.free = node;
+        }
+        stash.count += allocated;
+        cached_bytes_ += allocated * size;
+    }
+
+    /**
+     * @brief Returns `count` blocks of a size class to the parent
+     */
+    void flush(u64 index, u64 count)
+    {
+        u64 size = class_size(index);
+        mem::Block blocks[BATCH_SIZE];
+
+        Stash & stash = stashes_[index];
+        while (count > 0 and stash.free != null)
+        {
+            u64 length = 0;
+            while (length < BATCH_SIZE and length < count and stash.free != null)
+            {
+                Node * node = stash.free;
+                stash.free = node->next;
+                blocks[length++] = mem::Block { node, size };
+            }
+
+            stash.count -= length;
+            cached_bytes_ -= length * size;
+            count -= length;
+            mem::deallocate_batch(*parent_, blocks, length);
+        }
+    }
+
+public:
+    /**
+     * @return Always null, caches belong to a single thread and have no global instance
+     */
+    static ThreadCacheAllocator * instance()
+    {
+        return null;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (not is_cached(size))
+        {
+            return parent_->allocate(size, alignment);
+        }
+
+        u64 index = class_of(size);
+        if (alignment > mem::DEFAULT_ALIGNMENT)
+        {
+            // NOTE:
+            //   Over-aligned blocks bypass the stash, but are still allocated with the
+            //   size of their class so they can be cached once they are freed
+            mem::Block block = parent_->allocate(class_size(index), alignment);
+            return block ? mem::Block { block.data, size } : mem::Block {};
+        }
+
+        Stash & stash = stashes_[index];
+        if (stash.free == null)
+        {
+            refill(index);
+            if (stash.free == null)
+            {
+                return mem::Block {};
+            }
+        }
+
+        Node * node = stash.free;
+        stash.free = node->next;
+        stash.count--;
+        cached_bytes_ -= class_size(index);
+        return mem::Block { node, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (not is_cached(size))
+        {
+            return parent_->allocate_zeroed(size, alignment);
+        }
+        return mem::zeroed(allocate(size, alignment));
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (is_cached(size))
+        {
+            return class_size(class_of(size));
+        }
+        return parent_->good_size(size, alignment);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace, which succeeds for cached
+     * blocks as long as the new size stays inside of the size class
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not block)
+        {
+            return false;
+        }
+
+        if (is_cached(block.size) or is_cached(size))
+        {
+            if (not is_cached(block.size) or not is_cached(size))
+            {
+                return false;
+            }
+            if (class_of(block.size) != class_of(size))
+            {
+                return false;
+            }
+
+            block = mem::Block { block.data, size };
+            return true;
+        }
+        return parent_->reallocate(block, size);
+    }
+
+    /**
+     * @brief Keeps a block of memory in the cache, returning part of the cache to the
+     * parent allocator when it goes over budget
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (not block)
+        {
+            return;
+        }
+
+        if (not is_cached(block.size))
+        {
+            parent_->deallocate(block);
+            return;
+        }
+
+        u64 index = class_of(block.size);
+        Stash & stash = stashes_[index];
+
+        Node * node = cast(Node *, block.data);
+        node->next = stash.free;
+        stash.free = node;
+        stash.count++;
+        cached_bytes_ += class_size(index);
+
+        if (cached_bytes_ > Budget)
+        {
+            flush(index, (stash.count + 1) / 2);
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        if (is_cached(block.size))
+        {
+            mem::Block parent_block { block.data, class_size(class_of(block.size)) };
+            return parent_->owns(parent_block);
+        }
+        return parent_->owns(block);
+    }
+
+    implicit ThreadCacheAllocator & operator=(ThreadCacheAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     *
+     * @param parent Pointer to the parent allocator shared between threads
+     */
+    implicit ThreadCacheAllocator(A * parent = A::instance()) : parent_(parent)
+    {
+    }
+
+    implicit ThreadCacheAllocator(ThreadCacheAllocator const & other) = delete;
+
+    /**
+     * @brief Returns every cached block to the parent allocator
+     */
+    implicit ~ThreadCacheAllocator()
+    {
+        for (u64 index = 0; index < CLASS_COUNT; ++index)
+        {
+            flush(index, stashes_[index].count);
+        }
+    }
+};
+}
\ No newline at end of file
@@ -0,0 +1,237 @@
+/**
+ * @file TracingAllocator.hpp
+ * @brief Allocator decorator which records every operation to a file
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief A single recorded allocator operation
+ */
+struct TraceRecord
+{
+    enum Operation
+    {
+        ALLOCATE,
+        REALLOCATE,
+        DEALLOCATE
+    };
+
+    u64 timestamp;
+
+    // NOTE:
+    //   Address of the block at the time of the operation, which identifies it until it
+    //   is deallocated
+    u64 block;
+
+    u64 size : 56;
+    u64 operation : 7;
+    u64 success : 1;
+};
+
+static_assert(sizeof(TraceRecord) == 24, "Trace records should stay compact");
+
+/**
+ * @brief Start of every trace file, followed by `count` instances of `mem::TraceRecord`
+ */
+struct TraceHeader
+{
+    constant u64 MAGIC = 0x31454341'52544c41;
+
+    u64 magic;
+    u64 count;
+};
+
+/**
+ * @brief Forwards every call to `A` and appends a `mem::TraceRecord` for it to a ring
+ * buffer, which is written out to the trace file whenever it fills up
+ *
+ * Nothing is written until `TracingAllocator::open()` is called, full buffers are
+ * simply dropped until then
+ *
+ * @tparam A Type of allocator to trace
+ * @tparam N Number of records buffered before writing them out
+ */
+template <typename A, u64 N = 4096>
+struct TracingAllocator : private A
+{
+private:
+    mem::TraceRecord records_[N];
+    u64 count_ = 0;
+    u64 written_ = 0;
+    io::File file_;
+
+    /**
+     * @brief Appends a record to the buffer, flushing it first if it is full
+     */
+    macro void record(mem::TraceRecord::Operation operation, void * block, u64 size, bool success)
+    {
+        if (count_ == N)
+        {
+            flush();
+        }
+
+        records_[count_++] = mem::TraceRecord {
+            sys::timestamp(),
+            cast(u64, block),
+            size,
+            cast(u64, operation),
+            success,
+        };
+    }
+
+    /**
+     * @brief Rewrites the header at the start of the trace file
+     */
+    void write_header()
+    {
+        mem::TraceHeader header { mem::TraceHeader::MAGIC, written_ };
+        file_.write({ cast(byte const *, &header), sizeof(header) }, 0);
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator, or null when the wrapped
+     * allocator has no global instance either
+     */
+    static TracingAllocator * instance()
+    {
+        if (A::instance() == null)
+        {
+            return null;
+        }
+
+        static TracingAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @brief Starts writing records to a new trace file
+     *
+     * @param filename Path of the trace file
+     */
+    void open(char * filename)
+    {
+        flush();
+        file_.close();
+
+        file_.open(filename);
+        written_ = 0;
+        if (file_.is_open())
+        {
+            write_header();
+        }
+    }
+
+    /**
+     * @brief Writes every buffered record to the trace file
+     */
+    void flush()
+    {
+        if (file_.is_open() and count_ > 0)
+        {
+            u64 offset = sizeof(mem::TraceHeader) + written_ * sizeof(mem::TraceRecord);
+            file_.write(
+                { cast(byte const *, records_), count_ * sizeof(mem::TraceRecord) },
+                offset
+            );
+
+            written_ += count_;
+            write_header();
+        }
+        count_ = 0;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        mem::Block block = A::allocate(size, alignment);
+        record(mem::TraceRecord::ALLOCATE, block.data, size, block);
+        return block;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        mem::Block block = A::allocate_zeroed(size, alignment);
+        record(mem::TraceRecord::ALLOCATE, block.data, size, block);
+        return block;
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return A::good_size(size, alignment);
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        bool success = A::reallocate(block, size);
+        record(mem::TraceRecord::REALLOCATE, block.data, size, success);
+        return success;
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        record(mem::TraceRecord::DEALLOCATE, block.data, block.size, true);
+        A::deallocate(block);
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return A::owns(block);
+    }
+
+    implicit TracingAllocator & operator=(TracingAllocator const & other) = delete;
+
+    /**
+     * @brief Default constructor
+     */
+    implicit TracingAllocator()
+    {
+    }
+
+    implicit TracingAllocator(TracingAllocator const & other) = delete;
+
+    /**
+     * @brief Writes out any buffered records
+     */
+    implicit ~TracingAllocator()
+    {
+        flush();
+    }
+};
+}
\ No newline at end of file
@@ -36,20 +36,29 @@ constant auto is_const = false;
 template <typename T>
 constant auto is_const<T const> = true;
 
+/**
+ * @brief Whether an object of type `T` can be moved to another address by copying its
+ * bytes and forgetting the original, without running a constructor or destructor
+ *
+ * Deduced for trivially copyable types, other types opt in by specializing it
+ */
+template <typename T>
+constant auto is_trivially_relocatable = __is_trivially_copyable(T);
+
 template< class T >
-std::noref_t<T> && reuse(T && t)
+constexpr std::noref_t<T> && reuse(T && t)
 {
     return cast(std::noref_t<T> &&, t);
 }
 
 template <typename T>
-T && forward(std::noref_t<T> & t)
+constexpr T && forward(std::noref_t<T> & t)
 {
     return cast(T &&, t);
 }
 
 template <typename T>
-T && forward(std::noref_t<T> && t)
+constexpr T && forward(std::noref_t<T> && t)
 {
     return cast(T &&, t);
 }
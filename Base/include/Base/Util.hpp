@@ -67,6 +67,24 @@ void raw_emplace(T & a, Ts... args)
     new (&a) T(std::forward<Ts>(args)...);
 }
 
+/**
+ * @param value An object
+ * @return Whether every byte of the object representation of `value` is zero
+ */
+template <typename T>
+bool is_zero_bytes(T const & value)
+{
+    byte const * bytes = cast(byte const *, &value);
+    for (u64 idx = 0; idx < sizeof(T); ++idx)
+    {
+        if (bytes[idx] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 // TODO@Daniel:
 //   These algorithms should check whether the two regions intersect
 
@@ -88,6 +106,15 @@ void fill_range(std::Span<T> a, T const & value)
 template <typename T>
 void raw_fill_range(T * a, u64 size, T const & value)
 {
+    if constexpr (__is_trivially_copyable(T))
+    {
+        if (util::is_zero_bytes(value))
+        {
+            mem::zeroed(mem::Block { a, size * sizeof(T) });
+            return;
+        }
+    }
+
     for (u64 idx = 0; idx < size; ++idx)
     {
         util::raw_copy(a[idx], value);
@@ -127,7 +154,7 @@ void copy_range(std::Span<T> a, std::Span<T> b)
 {
     assert(a.size() == b.size());
 
-    util::copy_range(a.data(), b.data(), a.data());
+    util::copy_range(a.data(), b.data(), a.size());
 }
 
 /**
@@ -140,9 +167,16 @@ void copy_range(std::Span<T> a, std::Span<T> b)
 template <typename T>
 void raw_copy_range(T * a, T const * b, u64 size)
 {
-    for (u64 idx = 0; idx < size; ++idx)
+    if constexpr (__is_trivially_copyable(T))
     {
-        util::raw_copy(a[idx], b[idx]);
+        mem::copy(a, b, size * sizeof(T));
+    }
+    else
+    {
+        for (u64 idx = 0; idx < size; ++idx)
+        {
+            util::raw_copy(a[idx], b[idx]);
+        }
     }
 }
 
@@ -170,9 +204,16 @@ void raw_copy_range(std::Span<T> a, std::Span<T> b)
 template <meta::not_readonly T>
 void move_range(T * a, T * b, u64 size)
 {
-    for (u64 idx = 0; idx < size; ++idx)
+    if constexpr (__is_trivially_copyable(T))
     {
-        util::move(a[idx], b[idx]);
+        mem::move(a, b, size * sizeof(T));
+    }
+    else
+    {
+        for (u64 idx = 0; idx < size; ++idx)
+        {
+            util::move(a[idx], b[idx]);
+        }
     }
 }
 
@@ -200,9 +241,16 @@ void move_range(std::Span<T> a, std::Span<T> b)
 template <typename T>
 void raw_move_range(T * a, T * b, u64 size)
 {
-    for (u64 idx = 0; idx < size; ++idx)
+    if constexpr (__is_trivially_copyable(T))
     {
-        util::raw_move(a[idx], b[idx]);
+        mem::copy(a, b, size * sizeof(T));
+    }
+    else
+    {
+        for (u64 idx = 0; idx < size; ++idx)
+        {
+            util::raw_move(a[idx], b[idx]);
+        }
     }
 }
 
@@ -219,4 +267,46 @@ void raw_move_range(std::Span<T> a, std::Span<T> b)
 
     util::raw_move_range(a.data(), b.data(), a.size());
 }
+
+/**
+ * @brief Relocates an array of objects to uninitialized memory, leaving the source
+ * memory uninitialized
+ *
+ * Trivially relocatable objects are copied in bulk, any other object is moved and its
+ * original destroyed
+ *
+ * @param a Destination address
+ * @param b Source address
+ * @param size Length of both blocks
+ */
+template <typename T>
+void relocate_range(T * a, T * b, u64 size)
+{
+    if constexpr (std::is_trivially_relocatable<T>)
+    {
+        mem::copy(a, b, size * sizeof(T));
+    }
+    else
+    {
+        for (u64 idx = 0; idx < size; ++idx)
+        {
+            util::raw_move(a[idx], b[idx]);
+            b[idx].~T();
+        }
+    }
+}
+
+/**
+ * @brief Relocates objects from one span to a span of unitialized memory
+ *
+ * @param a Destination span
+ * @param b Source span
+ */
+template <typename T>
+void relocate_range(std::Span<T> a, std::Span<T> b)
+{
+    assert(a.size() == b.size());
+
+    util::relocate_range(a.data(), b.data(), a.size());
+}
 }
\ No newline at end of file
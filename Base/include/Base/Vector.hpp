@@ -11,19 +11,73 @@
 
 namespace std
 {
+/**
+ * @brief Growth policy which grows a container to exactly the required capacity
+ */
+struct ExactGrowth
+{
+    /**
+     * @param required Minimum capacity that the container needs
+     * @return Capacity that the container should reserve, ignoring the current capacity
+     */
+    static constexpr macro u64 grow(u64, u64 required)
+    {
+        return required;
+    }
+};
+
+/**
+ * @brief Growth policy which scales the capacity of a container by `N / D`, which keeps
+ * the amortized cost of appending a single element constant
+ *
+ * @tparam N Numerator of the growth factor
+ * @tparam D Denominator of the growth factor
+ * @tparam M Minimum capacity of a non-empty container
+ */
+template <u64 N, u64 D, u64 M = 4>
+struct GeometricGrowth
+{
+    static_assert(N > D, "Growth factor must be larger than 1");
+
+    /**
+     * @param capacity Current capacity of the container
+     * @param required Minimum capacity that the container needs
+     * @return Capacity that the container should reserve
+     */
+    static constexpr macro u64 grow(u64 capacity, u64 required)
+    {
+        return math::max(math::max(capacity / D * N, required), M);
+    }
+};
+
+using DoublingGrowth = GeometricGrowth<2, 1>;
+using DefaultGrowth = GeometricGrowth<3, 2>;
+
 /**
  * @brief A dynamic array of objects
  *
  * @tparam T Type of underlying objects
  * @tparam A Type of allocator to use during allocation
  * @tparam Z Whether this vector type is null terminated
+ * @tparam G Growth policy used when an insertion runs out of capacity
+ * @tparam L Alignment of the underlying buffer, e.g. a cache line or SIMD register width
  */
-template <typename T, typename A = mem::SystemAllocator, bool Z = false>
+template <
+    typename T,
+    typename A = mem::SystemAllocator,
+    bool Z = false,
+    typename G = std::DefaultGrowth,
+    u64 L = alignof(T)>
 struct Vector : Span<T>
 {
 private:
     using Base = Span<T>;
-    using This = Vector<T, A>;
+    using This = Vector<T, A, Z, G, L>;
+
+    static_assert((L & (L - 1)) == 0, "Alignment must be a power of two");
+    static_assert(L >= alignof(T), "Alignment must not be weaker than that of T");
+
+    constant u64 ALIGNMENT = L < mem::DEFAULT_ALIGNMENT ? mem::DEFAULT_ALIGNMENT : L;
 
 protected:
     u64 allocated_size_ = 0;
@@ -51,14 +105,30 @@ protected:
      * @brief Reserves and sets `Vector::size()`, but does not (de)initialize invalidated
      * objects
      *
+     * Capacity grows according to the growth policy `G`, so repeated insertions only
+     * (re)allocate a logarithmic number of times
+     *
      * @param size New `Vector::size()` of this vector
      */
     macro void unsafe_resize(u64 size)
     {
-        reserve(size + Z);
+        if (size > capacity())
+        {
+            reserve(G::grow(capacity(), size));
+        }
         set_size(size);
     }
 
+    /**
+     * @param capacity Number of elements the internal memory block should hold
+     * @return Size of the block to request, rounded up to the usable size of the
+     * allocator so that the slack becomes capacity instead of being wasted
+     */
+    macro u64 block_size(u64 capacity)
+    {
+        return allocator().good_size((capacity + Z) * sizeof(T), ALIGNMENT);
+    }
+
     /**
      * @brief Attempt to reallocate the
      *
@@ -68,7 +138,7 @@ protected:
     macro bool reallocate(u64 new_capacity)
     {
         mem::Block block = memory_block();
-        if (allocator().reallocate(block, (new_capacity + Z) * sizeof(T)))
+        if (allocator().reallocate(block, block_size(new_capacity)))
         {
             set_allocated_size(block.size);
             return true;
@@ -76,6 +146,45 @@ protected:
         return false;
     }
 
+    /**
+     * @brief Moves every element into `block` and makes it the internal memory block
+     *
+     * @param block A newly allocated block of memory
+     */
+    macro void move_to(mem::Block block)
+    {
+        assert(block);
+
+        Base span { cast(Pointer, block.data), size() };
+        util::relocate_range(span, *this);
+        deallocate();
+
+        set_data(span.data());
+        set_allocated_size(block.size);
+    }
+
+    /**
+     * @brief Grows the internal memory block to hold `new_capacity` elements, asking for
+     * a zeroed block when the vector is empty
+     *
+     * @param new_capacity Number of elements that this vector should be able to hold
+     * @return Whether everything past `Vector::size()` is known to be zero
+     */
+    macro bool reserve_zeroed(u64 new_capacity)
+    {
+        // NOTE:
+        //   Allocators which cannot hand out fresh pages zero the whole block, so the
+        //   elements would be copied over zeroes which are never read
+        if (size() > 0)
+        {
+            reserve(new_capacity);
+            return false;
+        }
+
+        move_to(allocator().allocate_zeroed(block_size(new_capacity), ALIGNMENT));
+        return true;
+    }
+
     /**
      * @brief Deallocates the internal memory block
      */
@@ -119,7 +228,8 @@ public:
      */
     macro u64 capacity() const
     {
-        return allocated_size_ / sizeof(T) - Z * sizeof(T);
+        u64 slots = allocated_size_ / sizeof(T);
+        return slots > Z ? slots - Z : 0;
     }
 
     /**
@@ -140,15 +250,7 @@ public:
             return;
         }
 
-        mem::Block block = allocator().allocate(new_capacity * sizeof(T));
-        assert(block);
-
-        Base span { cast(Pointer, block.data), size() };
-        util::raw_move_range(span, *this);
-        deallocate();
-
-        set_data(span.data());
-        set_allocated_size(block.size);
+        move_to(allocator().allocate(block_size(new_capacity), ALIGNMENT));
     }
 
     /**
@@ -173,6 +275,21 @@ public:
         }
         else
         {
+            // NOTE:
+            //   Trivial elements which are all zero bytes are already in place when
+            //   growing into a zeroed block, which only costs page faults for large blocks
+            if constexpr (__is_trivially_copyable(T))
+            {
+                if (new_size > capacity() and util::is_zero_bytes(value))
+                {
+                    if (reserve_zeroed(G::grow(capacity(), new_size)))
+                    {
+                        set_size(new_size);
+                        return;
+                    }
+                }
+            }
+
             unsafe_resize(new_size);
             util::raw_fill_range(right(old_size), value);
         }
@@ -203,6 +320,92 @@ public:
         util::raw_emplace(at(old_size), std::forward<Ts>(args)...);
     }
 
+    /**
+     * @brief Copies objects to the end of the array, reserving space for all of them at
+     * once
+     *
+     * @param items Objects to append, must not point into this vector
+     */
+    macro void append(Span<T const> items)
+    {
+        u64 old_size = size();
+        unsafe_resize(old_size + items.size());
+        util::raw_copy_range(data() + old_size, items.data(), items.size());
+    }
+
+    /**
+     * @brief Copies objects into the array in front of the object at index `idx`
+     *
+     * @param idx Index at which the first new object ends up, at most `Vector::size()`
+     * @param items Objects to insert, must not point into this vector
+     */
+    macro void insert(u64 idx, Span<T const> items)
+    {
+        assert(idx <= size());
+
+        u64 old_size = size();
+        u64 count = items.size();
+        unsafe_resize(old_size + count);
+
+        T * tail = data() + idx;
+        if constexpr (std::is_trivially_relocatable<T>)
+        {
+            mem::move(tail + count, tail, (old_size - idx) * sizeof(T));
+        }
+        else
+        {
+            // NOTE:
+            //   Back to front, so no object is overwritten before it has been moved
+            for (u64 offset = old_size - idx; offset-- > 0;)
+            {
+                util::raw_move(tail[offset + count], tail[offset]);
+                tail[offset].~T();
+            }
+        }
+        util::raw_copy_range(tail, items.data(), count);
+    }
+
+    /**
+     * @brief Removes the objects from index `start` up to index `stop`, shifting the
+     * objects after them down
+     *
+     * @param start Index of the first object to remove
+     * @param stop Index one past the last object to remove, at most `Vector::size()`
+     */
+    macro void erase(u64 start, u64 stop)
+    {
+        assert(start <= stop);
+        assert(stop <= size());
+
+        u64 old_size = size();
+        u64 new_size = old_size - (stop - start);
+        util::move_range(data() + start, data() + stop, old_size - stop);
+        right(new_size).iter(T & item)
+        {
+            item.~T();
+        };
+        set_size(new_size);
+    }
+
+    /**
+     * @brief Removes the object at index `idx` in constant time by moving the last object
+     * into its place, which does not preserve the order of the array
+     *
+     * @param idx Index of the object to remove
+     */
+    macro void swap_remove(u64 idx)
+    {
+        assert(idx < size());
+
+        u64 last = size() - 1;
+        if (idx != last)
+        {
+            util::move(at(idx), at(last));
+        }
+        at(last).~T();
+        set_size(last);
+    }
+
     /**
      * @brief Removes all elements from the array
      */
@@ -242,20 +445,22 @@ public:
     /**
      * @brief Copy assignment operator
      */
-    macro Vector<T> & operator=(Vector const & other)
+    macro Vector & operator=(Vector const & other)
     {
         clear();
         unsafe_resize(other.size());
         util::raw_copy_range(*this, other);
+        return *this;
     }
 
     /**
      * @brief Move assignment operator
      */
-    macro Vector<T> & operator=(Vector && other)
+    macro Vector & operator=(Vector && other)
     {
         deallocate();
         util::swap(*this, other);
+        return *this;
     }
 
     /**
@@ -265,6 +470,10 @@ public:
      */
     implicit macro Vector(A * allocator = A::instance()) : allocator_(allocator)
     {
+        // NOTE:
+        //   Allocators without a global instance return null from `instance()`, so they
+        //   have to be passed in explicitly
+        assert(allocator != null);
     }
 
     /**
@@ -297,4 +506,9 @@ public:
         reset();
     }
 };
+
+// NOTE:
+//   A vector only refers to its buffer and allocator, neither of which point back at it
+template <typename T, typename A, bool Z, typename G, u64 L>
+constant auto is_trivially_relocatable<std::Vector<T, A, Z, G, L>> = true;
 }
\ No newline at end of file
@@ -0,0 +1,158 @@
+/**
+ * @file VirtualAllocator.hpp
+ * @brief Allocator which reserves address space up front and commits it on demand
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+namespace mem
+{
+/**
+ * @brief Reserves `R` bytes of address space for every block and only commits the
+ * pages the block actually uses
+ *
+ * Growing a block commits more pages at the end of its reservation, so `reallocate`
+ * succeeds until the reservation is exhausted and containers never have to copy their
+ * contents. Like `mem::SystemAllocator`, it claims every non-empty block and should be
+ * the last allocator of a fallback chain
+ *
+ * @tparam R Size of the address range reserved for every block
+ */
+template <u64 R = 64ull * 1024 * 1024 * 1024>
+struct VirtualAllocator
+{
+private:
+    /**
+     * @param size Size of a block
+     * @return Number of bytes that have to be committed for a block of this size
+     */
+    static u64 committed_size(u64 size)
+    {
+        return mem::align_up(size, sys::page_size());
+    }
+
+public:
+    /**
+     * @return A pointer to the global instance of this allocator
+     */
+    static VirtualAllocator * instance()
+    {
+        static VirtualAllocator instance_;
+        return &instance_;
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, at most the page size
+     * @return An allocated block of memory
+     */
+    mem::Block allocate(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (size > R or alignment > cast(u64, sys::page_size()))
+        {
+            return mem::Block {};
+        }
+
+        void * data = sys::reserve(R);
+        if (data == null)
+        {
+            return mem::Block {};
+        }
+
+        if (size > 0 and not sys::commit(data, committed_size(size)))
+        {
+            sys::unreserve(data, R);
+            return mem::Block {};
+        }
+        return mem::Block { data, size };
+    }
+
+    /**
+     * @param size Requested size of the allocation
+     * @param alignment Requested alignment of the allocation, a power of two
+     * @return An allocated block of memory, filled with zeroes, which every block is
+     * since it is committed from fresh pages
+     */
+    mem::Block allocate_zeroed(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        return allocate(size, alignment);
+    }
+
+    /**
+     * @param size Requested size of an allocation
+     * @param alignment Requested alignment of an allocation, a power of two
+     * @return Usable size of a block allocated with `size`
+     */
+    u64 good_size(u64 size, u64 alignment = mem::DEFAULT_ALIGNMENT)
+    {
+        if (alignment > cast(u64, sys::page_size()))
+        {
+            return size;
+        }
+
+        u64 good = committed_size(size);
+        return good <= R ? good : size;
+    }
+
+    /**
+     * @brief Tries to reallocate a block of memory inplace by (de)committing pages at
+     * the end of its reservation
+     *
+     * @param block A block of memory
+     * @param size The new requested size of the block
+     * @return Whether the allocator was successful in reallocatein the block
+     */
+    bool reallocate(mem::Block & block, u64 size)
+    {
+        if (not block or size > R)
+        {
+            return false;
+        }
+
+        byte * data = cast(byte *, block.data);
+        u64 old_committed = committed_size(block.size);
+        u64 new_committed = committed_size(size);
+
+        if (new_committed > old_committed)
+        {
+            if (not sys::commit(data + old_committed, new_committed - old_committed))
+            {
+                return false;
+            }
+        }
+        else if (new_committed < old_committed)
+        {
+            sys::decommit(data + new_committed, old_committed - new_committed);
+        }
+
+        block = mem::Block { block.data, size };
+        return true;
+    }
+
+    /**
+     * @brief Destroy and invalidate a block of memory
+     *
+     * @param block The block to deallocate
+     */
+    void deallocate(mem::Block & block)
+    {
+        if (block)
+        {
+            sys::unreserve(block.data, R);
+        }
+        block = mem::Block {};
+    }
+
+    /**
+     * @param block A block of memory
+     * @return Whether the block has been allocated by this allocator
+     */
+    bool owns(mem::Block & block)
+    {
+        return block.data != null;
+    }
+};
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+ * @file Checks.cpp
+ * @brief Compile-only checks which instantiate every allocator and container template
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// NOTE:
+//   Templates are only checked once they are instantiated, and neither the `Test` nor
+//   the `Benchmark` target is built. Explicit instantiations compile every member of
+//   these types with the Base target, which catches errors but does not run anything
+
+template struct std::Vector<u64>;
+template struct std::Vector<u64, mem::SystemAllocator, false, std::DoublingGrowth>;
+template struct std::Vector<u64, mem::SystemAllocator, false, std::ExactGrowth>;
+
+static_assert(std::ExactGrowth::grow(8, 9) == 9);
+static_assert(std::DoublingGrowth::grow(8, 9) == 16);
+static_assert(std::DefaultGrowth::grow(8, 9) == 12);
+static_assert(std::DefaultGrowth::grow(0, 1) == 4);
+
+template struct mem::ArenaAllocator<>;
+template struct mem::FreeListAllocator<1, 64>;
+template struct mem::Segregator<
+    mem::Thresholds<64, 1024>,
+    mem::FreeListAllocator<1, 63>,
+    mem::BitmappedBlockAllocator<64, 1024>,
+    mem::SystemAllocator
+>;
+template struct mem::StackAllocator<4096>;
+template struct mem::FallbackAllocator<mem::StackAllocator<4096>, mem::SystemAllocator>;
+template struct mem::VirtualAllocator<>;
+template struct mem::ThresholdAllocator<256, mem::FreeListAllocator<1, 255>, mem::HugePageAllocator>;
+template struct mem::StatsAllocator<mem::SystemAllocator>;
+template struct mem::TracingAllocator<mem::SystemAllocator>;
+template struct mem::ConcurrentSlabAllocator<64>;
+template struct mem::ThreadCacheAllocator<>;
+template struct mem::BitmappedBlockAllocator<64, 1024>;
+template struct mem::BuddyAllocator<64 * 1024>;
+template struct mem::ScratchAllocator<>;
+template struct mem::ObjectPool<u64>;
+
+static_assert(std::is_trivially_relocatable<std::Vector<u64>>);
+
+template struct std::SmallVector<u64, 8>;
+
+static_assert(std::SmallVector<u64, 8>::inline_capacity() == 8);
+
+template struct std::StaticVector<u64, 8>;
+
+static_assert(std::StaticVector<u64, 8>::capacity() == 8);
+
+template struct std::String<>;
+
+static_assert(std::is_trivially_relocatable<std::String<>>);
\ No newline at end of file
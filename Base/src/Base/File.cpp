@@ -9,10 +9,17 @@
  *
  */
 
+#if defined(_WIN32)
+
 #include <Windows.h>
 
 namespace io
 {
+File::File(char * filename) : File()
+{
+    open(filename);
+}
+
 void File::open(char * filename)
 {
     assert(filename != null);
@@ -79,11 +86,33 @@ i64 File::write(std::Span<byte const> data, i64 offset)
     return -1;
 }
 
-File::~File()
+void File::close()
 {
     if (handle != INVALID_HANDLE_VALUE)
     {
         CloseHandle(handle);
+        handle = INVALID_HANDLE_VALUE;
     }
 }
-}
\ No newline at end of file
+
+bool File::is_open() const
+{
+    return handle != INVALID_HANDLE_VALUE;
+}
+
+File::File() : handle(INVALID_HANDLE_VALUE)
+{
+}
+
+File::File(File && other) : handle(other.handle)
+{
+    other.handle = INVALID_HANDLE_VALUE;
+}
+
+File::~File()
+{
+    close();
+}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+/**
+ * @file FileLinux.cpp
+ * @brief Linux implementation of `io::File` on top of raw system calls
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#if defined(__linux__)
+
+#include <linux/fcntl.h>
+
+#include <Base/SystemCall.hpp>
+
+#define INVALID_FILE_HANDLE cast(void *, -1)
+
+// NOTE:
+//   `SEEK_END` lives in <linux/fs.h>, which drags in far more than it is worth
+constant i64 SEEK_FROM_END = 2;
+
+internal macro i64 file_descriptor(void * handle)
+{
+    return cast(i64, handle);
+}
+
+namespace io
+{
+File::File(char * filename) : File()
+{
+    open(filename);
+}
+
+void File::open(char * filename)
+{
+    assert(filename != null);
+
+    i64 result = system_call(__NR_openat, AT_FDCWD, cast(i64, filename), O_RDWR | O_CREAT, 0644);
+    if (not system_call_failed(result))
+    {
+        handle = cast(void *, result);
+    }
+}
+
+void File::close()
+{
+    if (handle != INVALID_FILE_HANDLE)
+    {
+        system_call(__NR_close, file_descriptor(handle));
+        handle = INVALID_FILE_HANDLE;
+    }
+}
+
+bool File::is_open() const
+{
+    return handle != INVALID_FILE_HANDLE;
+}
+
+i64 File::exact_size()
+{
+    i64 size = system_call(__NR_lseek, file_descriptor(handle), 0, SEEK_FROM_END);
+    if (system_call_failed(size))
+    {
+        return -1;
+    }
+    return size;
+}
+
+i64 File::read(std::Span<byte> data, i64 offset)
+{
+    if (data.empty())
+    {
+        return 0;
+    }
+
+    i64 size = system_call(
+        __NR_pread64,
+        file_descriptor(handle),
+        cast(i64, data.data()),
+        data.size(),
+        offset
+    );
+    if (system_call_failed(size))
+    {
+        return -1;
+    }
+    return size;
+}
+
+i64 File::write(std::Span<byte const> data, i64 offset)
+{
+    if (data.empty())
+    {
+        return 0;
+    }
+
+    i64 size = system_call(
+        __NR_pwrite64,
+        file_descriptor(handle),
+        cast(i64, data.data()),
+        data.size(),
+        offset
+    );
+    if (system_call_failed(size))
+    {
+        return -1;
+    }
+    return size;
+}
+
+File::File() : handle(INVALID_FILE_HANDLE)
+{
+}
+
+File::File(File && other) : handle(other.handle)
+{
+    other.handle = INVALID_FILE_HANDLE;
+}
+
+File::~File()
+{
+    close();
+}
+}
+
+#endif
\ No newline at end of file
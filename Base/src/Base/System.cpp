@@ -1,10 +1,51 @@
+#if defined(_WIN32)
+
 #include <Windows.h>
 
 // #include <charconv>
 
+// NOTE:
+//   Every block is preceded by a 16 byte header pointing at the start of the heap block,
+//   which lets over-aligned blocks be freed and reallocated like any other block
+constant i64 HEADER_SIZE = 16;
+
+struct BlockHeader
+{
+    byte * base;
+    u64 reserved;
+};
+
 internal void * ModuleHandle;
 internal void * ProcessHeap;
 
+internal macro BlockHeader * header_of(void * data)
+{
+    return cast(BlockHeader *, cast(byte *, data) - HEADER_SIZE);
+}
+
+/**
+ * @brief Allocates a heap block with room for the header and for aligning it
+ *
+ * @param flags Flags passed on to `HeapAlloc`
+ */
+internal void * allocate_block(i64 size, i64 alignment, u32 flags)
+{
+    if (alignment < HEADER_SIZE)
+    {
+        alignment = HEADER_SIZE;
+    }
+
+    byte * base = cast(byte *, HeapAlloc(ProcessHeap, flags, size + HEADER_SIZE + alignment - 16));
+    if (base == null)
+    {
+        return null;
+    }
+
+    byte * data = cast(byte *, mem::align_up(cast(u64, base + HEADER_SIZE), alignment));
+    header_of(data)->base = base;
+    return data;
+}
+
 namespace sys
 {
 void * module_handle()
@@ -12,9 +53,43 @@ void * module_handle()
     return ModuleHandle;
 }
 
-void * allocate(i64 size)
+void * allocate(i64 size, i64 alignment)
 {
-    return cast(void *, HeapAlloc(ProcessHeap, 0, size));
+    return allocate_block(size, alignment, 0);
+}
+
+void * allocate_zeroed(i64 size, i64 alignment)
+{
+    return allocate_block(size, alignment, HEAP_ZERO_MEMORY);
+}
+
+i64 allocate_batch(i64 count, i64 size, void ** out, i64 alignment)
+{
+    for (i64 idx = 0; idx < count; ++idx)
+    {
+        out[idx] = allocate(size, alignment);
+        if (out[idx] == null)
+        {
+            return idx;
+        }
+    }
+    return count;
+}
+
+void deallocate_batch(void ** data, i64 count)
+{
+    for (i64 idx = 0; idx < count; ++idx)
+    {
+        deallocate(data[idx]);
+    }
+}
+
+i64 good_size(i64 size, i64)
+{
+    // NOTE:
+    //   The process heap hands out blocks with a granularity of 16 bytes, and the slack
+    //   reserved for aligning a block is never less than the padding in front of it
+    return mem::align_up(size, 16);
 }
 
 bool reallocate(void * data, i64 size)
@@ -23,12 +98,96 @@ bool reallocate(void * data, i64 size)
     {
         return false;
     }
-    return HeapReAlloc(ProcessHeap, HEAP_REALLOC_IN_PLACE_ONLY, data, size) != null;
+
+    byte * base = header_of(data)->base;
+    i64 offset = cast(byte *, data) - base;
+    return HeapReAlloc(ProcessHeap, HEAP_REALLOC_IN_PLACE_ONLY, base, offset + size) != null;
 }
 
 void deallocate(void * ptr)
 {
-    HeapFree(ProcessHeap, 0, ptr);
+    if (ptr != null)
+    {
+        HeapFree(ProcessHeap, 0, header_of(ptr)->base);
+    }
+}
+
+i64 page_size()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+}
+
+void * reserve(i64 size)
+{
+    return VirtualAlloc(null, size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+bool commit(void * data, i64 size)
+{
+    return VirtualAlloc(data, size, MEM_COMMIT, PAGE_READWRITE) != null;
+}
+
+void decommit(void * data, i64 size)
+{
+    VirtualFree(data, size, MEM_DECOMMIT);
+}
+
+void unreserve(void * data, i64 size)
+{
+    VirtualFree(data, 0, MEM_RELEASE);
+}
+
+i64 huge_page_size()
+{
+    u64 size = GetLargePageMinimum();
+    return size != 0 ? size : 2 * 1024 * 1024;
+}
+
+void * allocate_huge_pages(i64 size)
+{
+    void * data = VirtualAlloc(
+        null,
+        size,
+        MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+        PAGE_READWRITE
+    );
+
+    // NOTE:
+    //   Large pages require `SeLockMemoryPrivilege`, which most processes do not have
+    if (data != null)
+    {
+        return data;
+    }
+
+    // NOTE:
+    //   Regular reservations are only aligned to 64KiB, so reserve an extra huge page
+    //   and commit the aligned range inside of it
+    i64 alignment = huge_page_size();
+    byte * reservation = cast(byte *, VirtualAlloc(null, size + alignment, MEM_RESERVE, PAGE_NOACCESS));
+    if (reservation == null)
+    {
+        return null;
+    }
+
+    data = cast(void *, mem::align_up(cast(u64, reservation), alignment));
+    if (VirtualAlloc(data, size, MEM_COMMIT, PAGE_READWRITE) == null)
+    {
+        VirtualFree(reservation, 0, MEM_RELEASE);
+        return null;
+    }
+    return data;
+}
+
+void deallocate_huge_pages(void * data, i64 size)
+{
+    // NOTE:
+    //   Regular page fallbacks start inside of their reservation, which can only be
+    //   released through its base address
+    MEMORY_BASIC_INFORMATION info;
+    VirtualQuery(data, &info, sizeof(info));
+    VirtualFree(info.AllocationBase, 0, MEM_RELEASE);
 }
 }
 
@@ -44,4 +203,6 @@ int entry_point()
     ProcessHeap = cast(void *, GetProcessHeap());
 
     return Main();
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,65 @@
+/**
+ * @file SystemCall.hpp
+ * @brief Raw Linux system calls, shared by the Linux implementation files
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <asm/unistd.h>
+
+internal macro i64 system_call(
+    i64 number,
+    i64 a = 0,
+    i64 b = 0,
+    i64 c = 0,
+    i64 d = 0,
+    i64 e = 0,
+    i64 f = 0
+)
+{
+#if defined(__x86_64__)
+    register i64 r10 asm("r10") = d;
+    register i64 r8 asm("r8") = e;
+    register i64 r9 asm("r9") = f;
+
+    i64 result;
+    asm volatile("syscall"
+                 : "=a"(result)
+                 : "a"(number), "D"(a), "S"(b), "d"(c), "r"(r10), "r"(r8), "r"(r9)
+                 : "rcx", "r11", "memory");
+    return result;
+#elif defined(__aarch64__)
+    register i64 x8 asm("x8") = number;
+    register i64 x0 asm("x0") = a;
+    register i64 x1 asm("x1") = b;
+    register i64 x2 asm("x2") = c;
+    register i64 x3 asm("x3") = d;
+    register i64 x4 asm("x4") = e;
+    register i64 x5 asm("x5") = f;
+
+    asm volatile("svc 0"
+                 : "+r"(x0)
+                 : "r"(x8), "r"(x1), "r"(x2), "r"(x3), "r"(x4), "r"(x5)
+                 : "memory");
+    return x0;
+#else
+    #error "Unsupported architecture"
+#endif
+}
+
+/**
+ * @return Whether the result of a system call is an error code
+ */
+internal macro bool system_call_failed(i64 result)
+{
+    return cast(u64, result) > cast(u64, -4096);
+}
+
+#endif
\ No newline at end of file
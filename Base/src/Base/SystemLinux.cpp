@@ -0,0 +1,520 @@
+/**
+ * @file SystemLinux.cpp
+ * @brief Linux implementation of the `sys` layer on top of raw system calls
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#if defined(__linux__)
+
+#include <linux/mman.h>
+
+#include <Base/SystemCall.hpp>
+
+#if defined(__x86_64__)
+    #define entry_point_alignment __attribute__((force_align_arg_pointer))
+#else
+    #define entry_point_alignment
+#endif
+
+constant i64 PAGE_SIZE = 4096;
+constant i64 HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// NOTE:
+//   Every block starts with a 16 byte header, which keeps user memory 16 byte aligned
+constant i64 HEADER_SIZE = 16;
+
+// NOTE:
+//   Small blocks (header included) are rounded up to a power of two between 32 bytes
+//   and 128KiB and carved out of 1MiB chunks, everything larger is mapped directly
+constant i64 SMALLEST_CLASS_SHIFT = 5;
+constant i64 LARGEST_CLASS_SHIFT = 17;
+constant i64 CLASS_COUNT = LARGEST_CLASS_SHIFT - SMALLEST_CLASS_SHIFT + 1;
+constant i64 CHUNK_SIZE = 1 << 20;
+
+struct BlockHeader
+{
+    enum Kind
+    {
+        SMALL,
+        MAPPED,
+        ALIGNED
+    };
+
+    // NOTE:
+    //   Size of the whole block for small blocks, size of the whole mapping for mapped
+    //   blocks and distance to the underlying block for over-aligned blocks
+    u64 size;
+    u64 kind;
+};
+
+struct FreeBlock
+{
+    FreeBlock * next;
+};
+
+internal void * ModuleHandle;
+
+internal i32 HeapLock;
+internal FreeBlock * FreeLists[CLASS_COUNT];
+internal byte * ChunkCursor;
+internal byte * ChunkEnd;
+
+extern "C" byte __ehdr_start;
+
+internal macro u64 round_to_pages(u64 size)
+{
+    return (size + PAGE_SIZE - 1) & ~cast(u64, PAGE_SIZE - 1);
+}
+
+internal void * map_pages(u64 size, i64 protection = PROT_READ | PROT_WRITE, i64 flags = 0)
+{
+    i64 result = system_call(
+        __NR_mmap,
+        0,
+        size,
+        protection,
+        MAP_PRIVATE | MAP_ANONYMOUS | flags,
+        -1,
+        0
+    );
+    if (system_call_failed(result))
+    {
+        return null;
+    }
+    return cast(void *, result);
+}
+
+internal macro void spin_pause()
+{
+#if defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+internal macro void lock_heap()
+{
+    while (__atomic_exchange_n(&HeapLock, 1, __ATOMIC_ACQUIRE) != 0)
+    {
+        while (__atomic_load_n(&HeapLock, __ATOMIC_RELAXED) != 0)
+        {
+            spin_pause();
+        }
+    }
+}
+
+internal macro void unlock_heap()
+{
+    __atomic_store_n(&HeapLock, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @param size Size of a block, header included
+ * @return Index of the smallest size class that can hold the block
+ */
+internal macro i64 size_class(u64 size)
+{
+    if (size <= (1 << SMALLEST_CLASS_SHIFT))
+    {
+        return 0;
+    }
+    return 64 - __builtin_clzll(size - 1) - SMALLEST_CLASS_SHIFT;
+}
+
+/**
+ * @brief Takes a block of a size class from its free list or from the current chunk,
+ * the heap lock has to be held
+ */
+internal BlockHeader * take_small(i64 index)
+{
+    u64 class_size = cast(u64, 1) << (index + SMALLEST_CLASS_SHIFT);
+
+    BlockHeader * header = cast(BlockHeader *, FreeLists[index]);
+    if (header != null)
+    {
+        FreeLists[index] = FreeLists[index]->next;
+    }
+    else
+    {
+        if (ChunkCursor == null or cast(u64, ChunkEnd - ChunkCursor) < class_size)
+        {
+            // NOTE:
+            //   The tail of the previous chunk is leaked, it is never larger than the
+            //   largest size class and keeps the carving logic trivial
+            ChunkCursor = cast(byte *, map_pages(CHUNK_SIZE));
+            ChunkEnd = ChunkCursor != null ? ChunkCursor + CHUNK_SIZE : null;
+        }
+
+        if (ChunkCursor != null)
+        {
+            header = cast(BlockHeader *, ChunkCursor);
+            ChunkCursor += class_size;
+        }
+    }
+
+    if (header != null)
+    {
+        header->size = class_size;
+        header->kind = BlockHeader::SMALL;
+    }
+    return header;
+}
+
+/**
+ * @brief Puts a small block back in its free list, the heap lock has to be held
+ */
+internal void give_small(BlockHeader * header)
+{
+    i64 index = size_class(header->size);
+    FreeBlock * block = cast(FreeBlock *, header);
+    block->next = FreeLists[index];
+    FreeLists[index] = block;
+}
+
+internal BlockHeader * allocate_small(u64 size)
+{
+    lock_heap();
+    BlockHeader * header = take_small(size_class(size));
+    unlock_heap();
+    return header;
+}
+
+internal BlockHeader * allocate_large(u64 size)
+{
+    u64 mapping_size = round_to_pages(size);
+
+    BlockHeader * header = cast(BlockHeader *, map_pages(mapping_size));
+    if (header != null)
+    {
+        header->size = mapping_size;
+        header->kind = BlockHeader::MAPPED;
+    }
+    return header;
+}
+
+internal macro BlockHeader * header_of(void * data)
+{
+    return cast(BlockHeader *, cast(byte *, data) - HEADER_SIZE);
+}
+
+/**
+ * @return Header of the block which holds `data`, skipping over the extra header of
+ * over-aligned blocks
+ */
+internal macro BlockHeader * underlying_header_of(void * data)
+{
+    BlockHeader * header = header_of(data);
+    if (header->kind == BlockHeader::ALIGNED)
+    {
+        header = header_of(cast(byte *, data) - header->size);
+    }
+    return header;
+}
+
+namespace sys
+{
+void * module_handle()
+{
+    return ModuleHandle;
+}
+
+void * allocate(i64 size, i64 alignment)
+{
+    if (size < 0)
+    {
+        return null;
+    }
+
+    // NOTE:
+    //   Over-aligned blocks are allocated with enough slack to align them and get an
+    //   extra header which points back at the underlying block
+    u64 slack = alignment > HEADER_SIZE ? alignment : 0;
+    u64 total_size = size + slack + HEADER_SIZE;
+
+    BlockHeader * header;
+    if (total_size <= (1 << LARGEST_CLASS_SHIFT))
+    {
+        header = allocate_small(total_size);
+    }
+    else
+    {
+        header = allocate_large(total_size);
+    }
+
+    if (header == null)
+    {
+        return null;
+    }
+
+    byte * data = cast(byte *, header) + HEADER_SIZE;
+    if (slack > 0)
+    {
+        byte * aligned = cast(byte *, mem::align_up(cast(u64, data), alignment));
+        if (aligned != data)
+        {
+            BlockHeader * aligned_header = header_of(aligned);
+            aligned_header->size = aligned - data;
+            aligned_header->kind = BlockHeader::ALIGNED;
+        }
+        data = aligned;
+    }
+    return data;
+}
+
+void * allocate_zeroed(i64 size, i64 alignment)
+{
+    void * data = allocate(size, alignment);
+    if (data == null)
+    {
+        return null;
+    }
+
+    // NOTE:
+    //   Mapped blocks always come straight from `mmap`, only small blocks may have been
+    //   used before
+    if (underlying_header_of(data)->kind != BlockHeader::MAPPED)
+    {
+        u64 * words = cast(u64 *, data);
+        for (i64 idx = 0; idx < (size + 7) / 8; ++idx)
+        {
+            words[idx] = 0;
+        }
+    }
+    return data;
+}
+
+i64 good_size(i64 size, i64 alignment)
+{
+    if (size < 0)
+    {
+        return size;
+    }
+
+    // NOTE:
+    //   Has to match `sys::allocate`, otherwise the slack of over-aligned blocks pushes a
+    //   good size into the next size class
+    u64 slack = alignment > HEADER_SIZE ? alignment : 0;
+    u64 total_size = size + slack + HEADER_SIZE;
+    if (total_size <= (1 << LARGEST_CLASS_SHIFT))
+    {
+        return (cast(i64, 1) << (size_class(total_size) + SMALLEST_CLASS_SHIFT)) - HEADER_SIZE - slack;
+    }
+    return round_to_pages(total_size) - HEADER_SIZE - slack;
+}
+
+bool reallocate(void * data, i64 size)
+{
+    if (data == null or size < 0)
+    {
+        return false;
+    }
+
+    BlockHeader * header = header_of(data);
+    if (header->kind == BlockHeader::ALIGNED)
+    {
+        size += header->size;
+    }
+    header = underlying_header_of(data);
+
+    u64 total_size = size + HEADER_SIZE;
+
+    if (header->kind == BlockHeader::SMALL)
+    {
+        return total_size <= header->size;
+    }
+
+    u64 mapping_size = round_to_pages(total_size);
+    if (mapping_size == header->size)
+    {
+        return true;
+    }
+
+    // NOTE:
+    //   Without `MREMAP_MAYMOVE` the kernel either extends/truncates the mapping at the
+    //   same address or fails, which is exactly the inplace contract
+    i64 result = system_call(__NR_mremap, cast(i64, header), header->size, mapping_size, 0);
+    if (system_call_failed(result))
+    {
+        return false;
+    }
+
+    header->size = mapping_size;
+    return true;
+}
+
+void deallocate(void * data)
+{
+    if (data == null)
+    {
+        return;
+    }
+
+    BlockHeader * header = underlying_header_of(data);
+    if (header->kind == BlockHeader::MAPPED)
+    {
+        system_call(__NR_munmap, cast(i64, header), header->size);
+        return;
+    }
+
+    lock_heap();
+    give_small(header);
+    unlock_heap();
+}
+
+i64 allocate_batch(i64 count, i64 size, void ** out, i64 alignment)
+{
+    // NOTE:
+    //   Blocks taken straight from a size class are only aligned to the header, anything
+    //   else goes through `sys::allocate` one by one
+    u64 total_size = size + HEADER_SIZE;
+    if (size < 0 or alignment > HEADER_SIZE or total_size > (1 << LARGEST_CLASS_SHIFT))
+    {
+        for (i64 idx = 0; idx < count; ++idx)
+        {
+            out[idx] = allocate(size, alignment);
+            if (out[idx] == null)
+            {
+                return idx;
+            }
+        }
+        return count;
+    }
+
+    // NOTE:
+    //   Small blocks of a batch all come from the same size class, so the heap lock only
+    //   has to be taken once
+    i64 index = size_class(total_size);
+    i64 allocated = 0;
+
+    lock_heap();
+    for (; allocated < count; ++allocated)
+    {
+        BlockHeader * header = take_small(index);
+        if (header == null)
+        {
+            break;
+        }
+        out[allocated] = cast(byte *, header) + HEADER_SIZE;
+    }
+    unlock_heap();
+
+    return allocated;
+}
+
+void deallocate_batch(void ** data, i64 count)
+{
+    bool locked = false;
+    for (i64 idx = 0; idx < count; ++idx)
+    {
+        if (data[idx] == null)
+        {
+            continue;
+        }
+
+        BlockHeader * header = underlying_header_of(data[idx]);
+        if (header->kind == BlockHeader::MAPPED)
+        {
+            system_call(__NR_munmap, cast(i64, header), header->size);
+            continue;
+        }
+
+        if (not locked)
+        {
+            lock_heap();
+            locked = true;
+        }
+        give_small(header);
+    }
+
+    if (locked)
+    {
+        unlock_heap();
+    }
+}
+
+i64 page_size()
+{
+    return PAGE_SIZE;
+}
+
+void * reserve(i64 size)
+{
+    return map_pages(size, PROT_NONE, MAP_NORESERVE);
+}
+
+bool commit(void * data, i64 size)
+{
+    i64 result = system_call(__NR_mprotect, cast(i64, data), size, PROT_READ | PROT_WRITE);
+    return not system_call_failed(result);
+}
+
+void decommit(void * data, i64 size)
+{
+    system_call(__NR_madvise, cast(i64, data), size, MADV_DONTNEED);
+    system_call(__NR_mprotect, cast(i64, data), size, PROT_NONE);
+}
+
+void unreserve(void * data, i64 size)
+{
+    system_call(__NR_munmap, cast(i64, data), size);
+}
+
+i64 huge_page_size()
+{
+    return HUGE_PAGE_SIZE;
+}
+
+void * allocate_huge_pages(i64 size)
+{
+    size = mem::align_up(size, HUGE_PAGE_SIZE);
+
+    // NOTE:
+    //   Map an extra huge page so an aligned range fits inside, then trim both ends
+    u64 mapping_size = size + HUGE_PAGE_SIZE;
+    byte * mapping = cast(byte *, map_pages(mapping_size));
+    if (mapping == null)
+    {
+        return null;
+    }
+
+    byte * data = cast(byte *, mem::align_up(cast(u64, mapping), HUGE_PAGE_SIZE));
+    u64 head = data - mapping;
+    u64 tail = mapping_size - head - size;
+    if (head > 0)
+    {
+        system_call(__NR_munmap, cast(i64, mapping), head);
+    }
+    if (tail > 0)
+    {
+        system_call(__NR_munmap, cast(i64, data + size), tail);
+    }
+
+    // NOTE:
+    //   Fails when transparent huge pages are disabled, the range is still usable with
+    //   regular pages in that case
+    system_call(__NR_madvise, cast(i64, data), size, MADV_HUGEPAGE);
+    return data;
+}
+
+void deallocate_huge_pages(void * data, i64 size)
+{
+    system_call(__NR_munmap, cast(i64, data), mem::align_up(size, HUGE_PAGE_SIZE));
+}
+}
+
+extern int Main();
+
+extern "C" [[noreturn]] entry_point_alignment void entry_point()
+{
+    ModuleHandle = cast(void *, &__ehdr_start);
+
+    system_call(__NR_exit_group, Main());
+    __builtin_unreachable();
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,174 @@
+/**
+ * @file Replay.cpp
+ * @brief Replays a trace recorded by `mem::TracingAllocator` against allocator stacks
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+// NOTE:
+//   Record a trace with `mem::TracingAllocator::open()` and copy it next to the
+//   benchmark executable under this name
+internal char TRACE_PATH[] = "allocator.trace";
+
+/**
+ * @brief A recorded trace where block addresses have been replaced by dense slot
+ * indices, slot 0 being reserved for operations on empty blocks
+ */
+struct Trace
+{
+    std::Vector<mem::TraceRecord> records;
+    u64 slot_count = 1;
+};
+
+/**
+ * @brief Replaces every block address in `trace` with the index of the allocation
+ * that produced it
+ *
+ * An address cannot be handed out again while its block is alive, so the slot of the
+ * most recent allocation at an address is the one every later operation refers to
+ */
+internal void assign_slots(Trace & trace)
+{
+    u64 capacity = 16;
+    while (capacity < trace.records.size() * 2)
+    {
+        capacity *= 2;
+    }
+
+    std::Vector<u64> addresses;
+    std::Vector<u64> slots;
+    addresses.resize(capacity, 0);
+    slots.resize(capacity, 0);
+
+    auto find = [&](u64 address) -> u64 & {
+        u64 idx = (address >> 4) * 0x9E3779B97F4A7C15ull & (capacity - 1);
+        while (addresses[idx] != 0 and addresses[idx] != address)
+        {
+            idx = (idx + 1) & (capacity - 1);
+        }
+        addresses[idx] = address;
+        return slots[idx];
+    };
+
+    trace.records.iter(mem::TraceRecord & record)
+    {
+        if (record.block == 0)
+        {
+            return;
+        }
+
+        u64 & slot = find(record.block);
+        if (record.operation == mem::TraceRecord::ALLOCATE)
+        {
+            slot = trace.slot_count++;
+        }
+        record.block = slot;
+    };
+}
+
+/**
+ * @return The trace at `TRACE_PATH`, loaded once
+ */
+internal Trace & recorded_trace()
+{
+    static Trace trace = [] {
+        Trace trace;
+
+        io::File file(TRACE_PATH);
+        mem::TraceHeader header {};
+        file.read({ cast(byte *, &header), sizeof(header) }, 0);
+        if (header.magic != mem::TraceHeader::MAGIC)
+        {
+            return trace;
+        }
+
+        trace.records.resize(header.count);
+        file.read(
+            { cast(byte *, trace.records.data()), header.count * sizeof(mem::TraceRecord) },
+            sizeof(header)
+        );
+        assign_slots(trace);
+        return trace;
+    }();
+    return trace;
+}
+
+template <typename A>
+static void Replay(benchmark::State & state)
+{
+    Trace & trace = recorded_trace();
+    if (trace.records.empty())
+    {
+        state.SkipWithError("No trace found, see TRACE_PATH");
+        return;
+    }
+
+    std::Vector<mem::Block> blocks;
+    blocks.resize(trace.slot_count);
+
+    u64 moves = 0;
+    for (auto _ : state)
+    {
+        A allocator;
+        trace.records.iter(mem::TraceRecord & record)
+        {
+            mem::Block & block = blocks[record.block];
+            switch (record.operation)
+            {
+            case mem::TraceRecord::ALLOCATE:
+                if (record.success)
+                {
+                    block = allocator.allocate(record.size);
+                }
+                break;
+            case mem::TraceRecord::REALLOCATE:
+                // NOTE:
+                //   When the recorded reallocation succeeded, the application never
+                //   had to move the block, so a failure here has to be paid for the same
+                //   way a container would
+                if (not allocator.reallocate(block, record.size) and record.success)
+                {
+                    mem::Block moved = allocator.allocate(record.size);
+                    allocator.deallocate(block);
+                    block = moved;
+                    moves++;
+                }
+                break;
+            case mem::TraceRecord::DEALLOCATE:
+                allocator.deallocate(block);
+                break;
+            }
+        };
+
+        blocks.iter(mem::Block & block)
+        {
+            if (block)
+            {
+                allocator.deallocate(block);
+            }
+        };
+    }
+
+    state.SetItemsProcessed(state.iterations() * trace.records.size());
+    state.counters["moves"] = benchmark::Counter(moves, benchmark::Counter::kAvgIterations);
+}
+
+using Stack = mem::FallbackAllocator<mem::StackAllocator<4096>, mem::SystemAllocator>;
+using Pooled = mem::ThresholdAllocator<
+    256,
+    mem::FreeListAllocator<1, 255>,
+    mem::SystemAllocator>;
+using Laddered = mem::ThresholdAllocator<
+    256,
+    mem::FreeListAllocator<1, 255>,
+    mem::ThresholdAllocator<1024 * 1024, mem::SystemAllocator, mem::HugePageAllocator>>;
+
+BENCHMARK_TEMPLATE(Replay, mem::SystemAllocator);
+BENCHMARK_TEMPLATE(Replay, Stack);
+BENCHMARK_TEMPLATE(Replay, Pooled);
+BENCHMARK_TEMPLATE(Replay, Laddered);
\ No newline at end of file
@@ -0,0 +1,43 @@
+/**
+ * @file Vector.cpp
+ * @brief Append throughput of `std::Vector` for each growth policy
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+template <typename G>
+static void VectorPushBack(benchmark::State & state)
+{
+    u64 count = state.range(0);
+    for (auto _ : state)
+    {
+        std::Vector<i64, mem::SystemAllocator, false, G> v;
+        for (u64 idx = 0; idx < count; ++idx)
+        {
+            v.push_back(idx);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// NOTE:
+//   `ExactGrowth` is quadratic whenever the heap cannot grow the block inplace, so it
+//   stops at 10^6 elements to keep the run time sane
+BENCHMARK_TEMPLATE(VectorPushBack, std::ExactGrowth)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(VectorPushBack, std::DefaultGrowth)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(VectorPushBack, std::DoublingGrowth)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
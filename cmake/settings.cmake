@@ -128,7 +128,17 @@ macro(setup target)
             -nostdlib
             -Wno-microsoft-template
         )
-        set(LINK LINKER:/subsystem:console,/entry:entry_point)
+        if (CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64")
+            # NOTE: 16 byte compare-and-swap for lock-free stacks with ABA tags
+            list(APPEND COMPILE -mcx16)
+        endif()
+        if (WIN32)
+            set(LINK LINKER:/subsystem:console,/entry:entry_point)
+        else()
+            # NOTE: clang only enables these implicitly when targeting windows-msvc
+            list(APPEND COMPILE -fms-extensions -fms-compatibility -fdelayed-template-parsing)
+            set(LINK -nostdlib -static LINKER:--entry=entry_point)
+        endif()
         set(DEBUG_COMPILE -Og -g -DCONFIG_RELEASE=0 -DCONFIG_DEBUG=1)
         set(RELEASE_COMPILE -Ofast -flto -march=native -DCONFIG_RELEASE=1 -DCONFIG_DEBUG=0)
         set(RELDEB_COMPILE ${RELEASE_COMPILE} -g)